@@ -0,0 +1,140 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+#pragma warning(disable:26434) // Function definition hides non-virtual function in base class
+#pragma warning(disable:26439) // Implicit noexcept
+#pragma warning(disable:26451) // Arithmetic overflow
+#pragma warning(disable:26495) // Uninitialized member variable
+#include "catch.hpp"
+#include "Common\RoundRobinJobSelector.h"
+
+// Tests of the round-robin selection between job managers that BackgroundJobProcessor uses to pick the next job
+namespace JobSchedulingTest
+{
+    struct TestJobManager
+    {
+        TestJobManager() : lastScheduledStamp(0) {}
+        uint64 lastScheduledStamp;
+    };
+
+    struct TestJob
+    {
+        TestJob() : manager(nullptr), next(nullptr), prev(nullptr), sequence(0) {}
+        TestJobManager *Manager() const { return manager; }
+        TestJob *Next() const { return next; }
+
+        TestJobManager *manager;
+        TestJob *next;
+        TestJob *prev;
+        int sequence;
+    };
+
+    class TestJobQueue
+    {
+    public:
+        TestJobQueue() : head(nullptr), tail(nullptr) {}
+
+        void Add(TestJob *job, TestJobManager *manager, int sequence)
+        {
+            job->manager = manager;
+            job->sequence = sequence;
+            job->next = nullptr;
+            job->prev = tail;
+            if (tail)
+            {
+                tail->next = job;
+            }
+            else
+            {
+                head = job;
+            }
+            tail = job;
+        }
+
+        TestJob *Unlink(const unsigned int scanLimit, uint64 &schedulingStamp)
+        {
+            if (!head)
+            {
+                return nullptr;
+            }
+
+            TestJob *job = JsUtil::RoundRobinJobSelector::SelectJob(head, scanLimit, schedulingStamp);
+            (job->prev ? job->prev->next : head) = job->next;
+            (job->next ? job->next->prev : tail) = job->prev;
+            return job;
+        }
+
+    private:
+        TestJob *head;
+        TestJob *tail;
+    };
+
+    TEST_CASE("JobScheduling_FloodingManagerDoesNotStarveOthers", "[JobScheduling]")
+    {
+        TestJobManager flooding, other;
+        TestJob floodingJobs[20], otherJobs[2];
+        TestJobQueue queue;
+        uint64 schedulingStamp = 0;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            queue.Add(&floodingJobs[i], &flooding, i);
+        }
+        for (int i = 0; i < 2; ++i)
+        {
+            queue.Add(&otherJobs[i], &other, i);
+        }
+
+        // The two managers alternate as long as both have jobs queued within the scan limit
+        TestJob *job = queue.Unlink(32, schedulingStamp);
+        CHECK(job == &floodingJobs[0]);
+        job = queue.Unlink(32, schedulingStamp);
+        CHECK(job == &otherJobs[0]);
+        job = queue.Unlink(32, schedulingStamp);
+        CHECK(job == &floodingJobs[1]);
+        job = queue.Unlink(32, schedulingStamp);
+        CHECK(job == &otherJobs[1]);
+
+        // The remaining jobs of the flooding manager are processed in the order they were queued
+        for (int i = 2; i < 20; ++i)
+        {
+            job = queue.Unlink(32, schedulingStamp);
+            REQUIRE(job != nullptr);
+            CHECK(job->Manager() == &flooding);
+            CHECK(job->sequence == i);
+        }
+        CHECK(queue.Unlink(32, schedulingStamp) == nullptr);
+    }
+
+    TEST_CASE("JobScheduling_ScanLimit", "[JobScheduling]")
+    {
+        TestJobManager flooding, other;
+        TestJob floodingJobs[8], otherJob;
+        TestJobQueue queue;
+        uint64 schedulingStamp = 0;
+
+        for (int i = 0; i < 8; ++i)
+        {
+            queue.Add(&floodingJobs[i], &flooding, i);
+        }
+        queue.Add(&otherJob, &other, 0);
+
+        // Make the other manager the least recently scheduled one
+        flooding.lastScheduledStamp = ++schedulingStamp;
+
+        // Jobs beyond the scan limit are not considered
+        TestJob *job = queue.Unlink(4, schedulingStamp);
+        CHECK(job == &floodingJobs[0]);
+
+        // Once the other manager's job is within the limit it is picked ahead of the flooding manager's
+        for (int i = 1; i < 5; ++i)
+        {
+            job = queue.Unlink(4, schedulingStamp);
+            CHECK(job == &floodingJobs[i]);
+        }
+        job = queue.Unlink(4, schedulingStamp);
+        CHECK(job == &otherJob);
+    }
+}
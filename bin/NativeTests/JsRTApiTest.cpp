@@ -9,6 +9,7 @@
 #pragma warning(disable:26495) // Uninitialized member variable
 #include "catch.hpp"
 #include <array>
+#include <vector>
 #include <process.h>
 #include <suppress.h>
 
@@ -2675,6 +2676,57 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringTest);
     }
 
+    void JsCreateStringAsciiTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Long ASCII strings are kept one byte per character until a wide buffer is needed
+        const char asciiInput[] = "The quick brown fox jumps over the lazy dog";
+        const size_t asciiLength = strlen(asciiInput);
+        JsValueRef result;
+        REQUIRE(JsCreateString(asciiInput, asciiLength, &result) == JsNoError);
+
+        size_t written;
+        REQUIRE(JsCopyString(result, nullptr, 0, &written) == JsNoError);
+        CHECK(written == asciiLength);
+
+        char utf8Result[64];
+        REQUIRE(JsCopyString(result, utf8Result, 10, &written) == JsNoError);
+        CHECK(written == 10);
+        CHECK(memcmp(utf8Result, asciiInput, 10) == 0);
+
+        char oneByteResult[64];
+        REQUIRE(JsCopyStringOneByte(result, 4, 5, oneByteResult, &written) == JsNoError);
+        CHECK(written == 5);
+        CHECK(memcmp(oneByteResult, "quick", 5) == 0);
+
+        // Using the string from script widens it; copies must be unaffected
+        JsValueRef global = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        JsPropertyIdRef propertyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("asciiString"), &propertyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, propertyId, result, true) == JsNoError);
+
+        JsValueRef scriptResult = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("asciiString.toUpperCase() + asciiString.length"), JS_SOURCE_CONTEXT_NONE, _u(""), &scriptResult) == JsNoError);
+        REQUIRE(JsCopyString(scriptResult, utf8Result, sizeof(utf8Result), &written) == JsNoError);
+        CHECK(written == asciiLength + 2);
+        CHECK(memcmp(utf8Result, "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG43", written) == 0);
+
+        REQUIRE(JsCopyString(result, utf8Result, sizeof(utf8Result), &written) == JsNoError);
+        CHECK(written == asciiLength);
+        CHECK(memcmp(utf8Result, asciiInput, written) == 0);
+
+        uint16_t utf16Result[64];
+        REQUIRE(JsCopyStringUtf16(result, 0, 3, utf16Result, &written) == JsNoError);
+        CHECK(written == 3);
+        CHECK(utf16Result[0] == 'T');
+        CHECK(utf16Result[2] == 'e');
+    }
+
+    TEST_CASE("ApiTest_JsCreateStringAsciiTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringAsciiTest);
+    }
+
     void ApiTest_JsSerializeArrayTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
     {
         LPCSTR raw_script = "(function (){return true;})();";
@@ -2758,6 +2810,225 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ApiTest_JsSerializeParseErrorTest);
     }
 
+    void ApiTest_JsSerializeProfileTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle runtime)
+    {
+        LPCWSTR script = _u("function inc(a) { return a + 1; } var sum = 0; for (var i = 0; i < 100; i++) { sum = inc(sum); } sum;");
+        const JsSourceContext sourceContext = 1;
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, sourceContext, _u("profile.js"), &result) == JsNoError);
+
+        JsValueRef profile = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerializeProfile(sourceContext, &profile) == JsNoError);
+        CHECK(profile != JS_INVALID_REFERENCE);
+
+        JsValueRef unknownProfile = JS_INVALID_REFERENCE;
+        CHECK(JsSerializeProfile(sourceContext + 1, &unknownProfile) == JsErrorInvalidArgument);
+        CHECK(JsSerializeProfile(JS_SOURCE_CONTEXT_NONE, &unknownProfile) == JsErrorInvalidArgument);
+
+        // The script has already been loaded in this context
+        CHECK(JsSetSerializedProfile(sourceContext, profile) == JsErrorInvalidArgument);
+
+        // Data not produced by JsSerializeProfile is rejected
+        JsValueRef garbage = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBuffer(64, &garbage) == JsNoError);
+        CHECK(JsSetSerializedProfile(sourceContext + 1, garbage) == JsErrorInvalidArgument);
+
+        JsContextRef oldContext = JS_INVALID_REFERENCE, secondContext = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&oldContext) == JsNoError);
+        REQUIRE(JsCreateContext(runtime, &secondContext) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        REQUIRE(JsSetSerializedProfile(sourceContext, profile) == JsNoError);
+        REQUIRE(JsRunScript(script, sourceContext, _u("profile.js"), &result) == JsNoError);
+
+        int sum = 0;
+        REQUIRE(JsNumberToInt(result, &sum) == JsNoError);
+        CHECK(sum == 100);
+
+        REQUIRE(JsSetCurrentContext(oldContext) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_JsSerializeProfile", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ApiTest_JsSerializeProfileTest);
+    }
+
+    JsValueRef CreateProfileBuffer(const BYTE *data, unsigned int length)
+    {
+        JsValueRef arrayBuffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBuffer(length, &arrayBuffer) == JsNoError);
+
+        BYTE *storage = nullptr;
+        unsigned int storageLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(arrayBuffer, &storage, &storageLength) == JsNoError);
+        REQUIRE(storageLength == length);
+        if (length != 0)
+        {
+            memcpy_s(storage, storageLength, data, length);
+        }
+        return arrayBuffer;
+    }
+
+    void ApiTest_JsSetSerializedProfileCorruptTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
+    {
+        // Most of the functions never run, so there are at least twice as many functions as profiles
+        LPCWSTR script = _u("function inc(a) { return a + 1; } function unused1() {} function unused2() {} function unused3() {}")
+            _u("var sum = 0; for (var i = 0; i < 100; i++) { sum = inc(sum); } sum;");
+        const JsSourceContext sourceContext = 1;
+        JsSourceContext nextSourceContext = sourceContext + 1;
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, sourceContext, _u("profile.js"), &result) == JsNoError);
+
+        JsValueRef profile = JS_INVALID_REFERENCE;
+        REQUIRE(JsSerializeProfile(sourceContext, &profile) == JsNoError);
+
+        BYTE *profileData = nullptr;
+        unsigned int profileLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(profile, &profileData, &profileLength) == JsNoError);
+        std::vector<BYTE> original(profileData, profileData + profileLength);
+
+        // Layout: magic, format version and engine version, the startup function bit vector (its length, padded to
+        // a pointer, followed by pointer sized words), the profile count and the profiles, each starting with the
+        // function id and the parameter count
+        const size_t headerSize = sizeof(unsigned int) * 3;
+        REQUIRE(original.size() > headerSize + sizeof(unsigned int));
+        unsigned int functionCount = 0;
+        memcpy_s(&functionCount, sizeof(functionCount), &original[headerSize], sizeof(functionCount));
+        const size_t bitsPerWord = sizeof(void *) * 8;
+        const size_t profileCountOffset = headerSize + sizeof(void *) * (1 + (functionCount + bitsPerWord - 1) / bitsPerWord);
+        const size_t profilesOffset = profileCountOffset + sizeof(unsigned int);
+        REQUIRE(original.size() > profilesOffset + sizeof(unsigned int) + sizeof(unsigned short));
+        unsigned int profileCount = 0;
+        memcpy_s(&profileCount, sizeof(profileCount), &original[profileCountOffset], sizeof(profileCount));
+        REQUIRE(profileCount != 0);
+        REQUIRE(functionCount >= profileCount * 2);
+
+        // An unmodified copy is accepted
+        CHECK(JsSetSerializedProfile(nextSourceContext++, CreateProfileBuffer(original.data(), profileLength)) == JsNoError);
+
+        // Truncated
+        for (unsigned int length = 0; length < profileLength; length++)
+        {
+            CHECK(JsSetSerializedProfile(nextSourceContext, CreateProfileBuffer(original.data(), length)) == JsErrorInvalidArgument);
+        }
+
+        auto checkRejected = [&](size_t offset, const void *value, size_t valueSize)
+        {
+            std::vector<BYTE> corrupt(original);
+            memcpy_s(&corrupt[offset], corrupt.size() - offset, value, valueSize);
+            CHECK(JsSetSerializedProfile(nextSourceContext, CreateProfileBuffer(corrupt.data(), (unsigned int)corrupt.size())) == JsErrorInvalidArgument);
+        };
+
+        // Oversized function, profile and per function counts
+        const unsigned int hugeCount = 0xFFFFFFFF;
+        const unsigned int tooManyFunctions = 10001;
+        const unsigned int tooManyProfiles = functionCount + 1;
+        const unsigned short hugeParamCount = 0xFFFF;
+        checkRejected(headerSize, &hugeCount, sizeof(hugeCount));
+        checkRejected(headerSize, &tooManyFunctions, sizeof(tooManyFunctions));
+        checkRejected(profileCountOffset, &hugeCount, sizeof(hugeCount));
+        checkRejected(profileCountOffset, &tooManyProfiles, sizeof(tooManyProfiles));
+        checkRejected(profilesOffset, &functionCount, sizeof(functionCount));
+        checkRejected(profilesOffset + sizeof(unsigned int), &hugeParamCount, sizeof(hugeParamCount));
+
+        // Every profile twice, so every function id is duplicated while the profile count is still in range
+        std::vector<BYTE> duplicated(original);
+        duplicated.insert(duplicated.end(), original.begin() + profilesOffset, original.end());
+        const unsigned int duplicatedProfileCount = profileCount * 2;
+        memcpy_s(&duplicated[profileCountOffset], sizeof(duplicatedProfileCount), &duplicatedProfileCount, sizeof(duplicatedProfileCount));
+        CHECK(JsSetSerializedProfile(nextSourceContext, CreateProfileBuffer(duplicated.data(), (unsigned int)duplicated.size())) == JsErrorInvalidArgument);
+
+        // None of the rejected buffers was registered
+        CHECK(JsSetSerializedProfile(nextSourceContext, profile) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_JsSetSerializedProfileCorrupt", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ApiTest_JsSetSerializedProfileCorruptTest);
+    }
+
+    static JsTTDStreamHandle CHAKRA_CALLBACK TTDOpenStreamCallback(size_t uriLength, const char* uri, size_t asciiNameLength, const char* asciiResourceName, bool read, bool write)
+    {
+        static int stream = 0;
+        return &stream;
+    }
+
+    static bool CHAKRA_CALLBACK TTDWriteBytesToStreamCallback(JsTTDStreamHandle handle, const byte* buff, size_t size, size_t* writtenCount)
+    {
+        *writtenCount = size;
+        return true;
+    }
+
+    static void CHAKRA_CALLBACK TTDFlushAndCloseStreamCallback(JsTTDStreamHandle handle, bool read, bool write)
+    {
+    }
+
+    static bool RunBoolScript(LPCWSTR script)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(script, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        bool value = false;
+        REQUIRE(JsBooleanToBool(result, &value) == JsNoError);
+        return value;
+    }
+
+    void ApiTest_JsTTDStartupSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Only record runtimes have a startup snapshot
+        CHECK(JsTTDCaptureStartupSnapshot(runtime) == JsErrorInvalidArgument);
+        CHECK(JsTTDRestoreStartupSnapshot(runtime) == JsErrorInvalidArgument);
+
+        JsRuntimeHandle recordRuntime = JS_INVALID_RUNTIME_HANDLE;
+        JsErrorCode error = JsTTDCreateRecordRuntime(attributes, false, UINT32_MAX, UINT32_MAX,
+            TTDOpenStreamCallback, TTDWriteBytesToStreamCallback, TTDFlushAndCloseStreamCallback, nullptr, &recordRuntime);
+        if (error == JsErrorCategoryUsage)
+        {
+            // Built without time travel debugging
+            return;
+        }
+        REQUIRE(error == JsNoError);
+
+        JsContextRef oldContext = JS_INVALID_REFERENCE, context = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&oldContext) == JsNoError);
+        REQUIRE(JsTTDCreateContext(recordRuntime, true, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        // Nothing was captured yet
+        CHECK(JsTTDRestoreStartupSnapshot(recordRuntime) == JsErrorInvalidArgument);
+
+        // Capture while recording the startup, then stop recording, which unloads the log but keeps the snapshot
+        REQUIRE(JsTTDStart() == JsNoError);
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var counter = 1; var config = { mode: 'startup', items: [1, 2] };"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsTTDCaptureStartupSnapshot(recordRuntime) == JsNoError);
+        REQUIRE(JsTTDStop() == JsNoError);
+
+        // The first restore inflates the snapshot, the second one reuses what the first one inflated
+        for (int i = 0; i < 2; i++)
+        {
+            REQUIRE(JsRunScript(_u("counter++; config.mode = 'changed'; config.items.push(3); var added = {};"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            CHECK(RunBoolScript(_u("counter === 2 && config.mode === 'changed' && typeof added === 'object'")));
+
+            REQUIRE(JsTTDRestoreStartupSnapshot(recordRuntime) == JsNoError);
+
+            // The existing context was reset, no new context was made current
+            JsContextRef currentContext = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetCurrentContext(&currentContext) == JsNoError);
+            CHECK(currentContext == context);
+            CHECK(RunBoolScript(_u("counter === 1 && config.mode === 'startup' && config.items.length === 2 && typeof added === 'undefined'")));
+        }
+
+        REQUIRE(JsSetCurrentContext(oldContext) == JsNoError);
+        REQUIRE(JsDisposeRuntime(recordRuntime) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_JsTTDStartupSnapshot", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ApiTest_JsTTDStartupSnapshotTest);
+    }
+
     void JsCreatePromiseTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         JsValueRef result = JS_INVALID_REFERENCE;
@@ -4900,7 +4900,7 @@ BackwardPass::UpdateArrayBailOutKind(IR::Instr *const instr)
     Assert(instr->HasBailOutInfo());
 
     if ((instr->m_opcode != Js::OpCode::StElemI_A && instr->m_opcode != Js::OpCode::StElemI_A_Strict &&
-        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset) ||
+        !instr->IsMemOpInstr()) ||
         !instr->GetDst()->IsIndirOpnd())
     {
         return;
@@ -5998,6 +5998,10 @@ BackwardPass::ProcessUse(IR::Opnd * opnd)
             }
         }
         break;
+    case IR::OpndKindList:
+        // Element-wise memops carry their extra operands in a list
+        opnd->AsListOpnd()->Map([&](int i, IR::RegOpnd* regOpnd) { this->ProcessUse(regOpnd); });
+        break;
     }
 }
 
@@ -1316,6 +1316,12 @@ Loop::MemSetCandidate* Loop::MemOpCandidate::AsMemSet()
     return (Loop::MemSetCandidate*)this;
 }
 
+Loop::MemArithCandidate* Loop::MemOpCandidate::AsMemArith()
+{
+    Assert(this->IsMemArith());
+    return (Loop::MemArithCandidate*)this;
+}
+
 void
 Loop::EnsureMemOpVariablesInitialized()
 {
@@ -621,6 +621,7 @@ class Loop
                                          // For example, in the lowerer, it'll be set to true when we process the loopTop for a certain loop
     struct MemCopyCandidate;
     struct MemSetCandidate;
+    struct MemArithCandidate;
     struct MemOpCandidate
     {
         SymID base;
@@ -630,12 +631,15 @@ class Loop
         enum MemOpType
         {
             MEMSET,
-            MEMCOPY
+            MEMCOPY,
+            MEMARITH
         } type;
         bool IsMemSet() const { return type == MEMSET; }
         bool IsMemCopy() const { return type == MEMCOPY; }
+        bool IsMemArith() const { return type == MEMARITH; }
         struct Loop::MemCopyCandidate* AsMemCopy();
         struct Loop::MemSetCandidate* AsMemSet();
+        struct Loop::MemArithCandidate* AsMemArith();
         MemOpCandidate(MemOpType type) :
             type(type)
         {
@@ -658,6 +662,20 @@ class Loop
         MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY) {}
     };
 
+    // dst[i] = src[i] op (src2[i] | invariant), built from the memcopy candidates of the loads it consumes
+    struct MemArithCandidate : public MemOpCandidate
+    {
+        Js::OpCode opcode;
+        SymID ldBase;
+        StackSym* ldSym;
+        SymID ldBase2;          // InvalidSymID when the second operand is invariant
+        StackSym* ldSym2;
+        BailoutConstantValue constant;
+        StackSym* srcSym;
+        StackSym* resultSym;
+        MemArithCandidate() : MemOpCandidate(MemOpCandidate::MEMARITH), ldSym2(nullptr), srcSym(nullptr) {}
+    };
+
 #define FOREACH_MEMOP_CANDIDATES_EDITING(data, loop, iterator) FOREACH_SLISTCOUNTED_ENTRY_EDITING(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates, iterator)
 #define NEXT_MEMOP_CANDIDATE_EDITING NEXT_SLISTCOUNTED_ENTRY_EDITING
 #define FOREACH_MEMOP_CANDIDATES(data, loop) FOREACH_SLISTCOUNTED_ENTRY(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates)
@@ -792,6 +810,13 @@ struct MemCopyEmitData : public MemOpEmitData
     IR::Instr* ldElemInstr;
 };
 
+struct MemArithEmitData : public MemOpEmitData
+{
+    IR::Instr* arithInstr;
+    IR::Instr* ldElemInstr;
+    IR::Instr* ldElemInstr2;
+};
+
 #define FOREACH_BLOCK_IN_FUNC(block, func)\
     FOREACH_BLOCK(block, func->m_fg)
 #define NEXT_BLOCK_IN_FUNC\
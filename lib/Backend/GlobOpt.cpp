@@ -7,7 +7,8 @@
 #if DBG_DUMP
 #define DO_MEMOP_TRACE() (PHASE_TRACE(Js::MemOpPhase, this->func) ||\
         PHASE_TRACE(Js::MemSetPhase, this->func) ||\
-        PHASE_TRACE(Js::MemCopyPhase, this->func))
+        PHASE_TRACE(Js::MemCopyPhase, this->func) ||\
+        PHASE_TRACE(Js::MemArithPhase, this->func))
 #define DO_MEMOP_TRACE_PHASE(phase) (PHASE_TRACE(Js::MemOpPhase, this->func) || PHASE_TRACE(Js::phase ## Phase, this->func))
 
 #define OUTPUT_MEMOP_TRACE(loop, instr, ...) {\
@@ -2087,11 +2088,244 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
     return true;
 }
 
+bool
+GlobOpt::CollectMemArithInstr(IR::Instr *instrBegin, IR::Instr *instr, Loop *loop, Value *src1Val, Value *src2Val)
+{
+    if (PHASE_OFF(Js::MemArithPhase, this->func))
+    {
+        return false;
+    }
+
+    bool isCommutative = true;
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::Sub_A:
+    case Js::OpCode::Sub_I4:
+        isCommutative = false;
+        break;
+    case Js::OpCode::Add_A:
+    case Js::OpCode::Add_I4:
+    case Js::OpCode::Mul_A:
+    case Js::OpCode::Mul_I4:
+        break;
+    default:
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Operation not supported"));
+        return false;
+    }
+
+    // Only accept operations that were type specialized, so that no conversion happens between the loads and the store
+    IR::Opnd *dst = instr->GetDst();
+    IR::Opnd *src1 = instr->GetSrc1();
+    IR::Opnd *src2 = instr->GetSrc2();
+    if (!dst || !dst->IsRegOpnd() || !src1 || !src2 || !(dst->IsInt32() || dst->IsFloat64()) ||
+        !dst->AsRegOpnd()->GetStackSym()->IsSingleDef())
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Operation is not type specialized"));
+        return false;
+    }
+
+    if (!loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        // There is no ldElem feeding this operation
+        return false;
+    }
+
+    // The loads feeding the operation were collected as memcopy candidates that are still waiting for their stElem
+    Loop::MemCopyCandidate* loads[2] = { nullptr, nullptr };
+    int loadCount = 0;
+    Loop::MemOpList::Iterator iter(loop->memOpInfo->candidates);
+    while (loadCount < 2 && iter.Next())
+    {
+        Loop::MemOpCandidate* candidate = iter.Data();
+        if (!candidate->IsMemCopy() || candidate->AsMemCopy()->base != Js::Constants::InvalidSymID)
+        {
+            break;
+        }
+        loads[loadCount++] = candidate->AsMemCopy();
+    }
+
+    FOREACH_INSTR_IN_RANGE(chkInstr, instrBegin->m_next, instr->m_prev)
+    {
+        if (IsInstrInvalidForMemOp(chkInstr, loop, src1Val, src2Val))
+        {
+            return false;
+        }
+        for (int i = 0; i < loadCount; i++)
+        {
+            if (chkInstr->HasSymUse(loads[i]->transferSym))
+            {
+                TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, chkInstr, _u("Found illegal use of LdElemI value(s%d)"), GetVarSymID(loads[i]->transferSym));
+                return false;
+            }
+        }
+    }
+    NEXT_INSTR_IN_RANGE;
+
+    const auto findLoad = [&](IR::Opnd *opnd) -> Loop::MemCopyCandidate*
+    {
+        if (!opnd->IsRegOpnd() || !opnd->AsRegOpnd()->GetIsDead())
+        {
+            return nullptr;
+        }
+        for (int i = 0; i < loadCount; i++)
+        {
+            if (GetVarSymID(loads[i]->transferSym) == GetVarSymID(opnd->AsRegOpnd()->GetStackSym()))
+            {
+                return loads[i];
+            }
+        }
+        return nullptr;
+    };
+
+    Loop::MemCopyCandidate* load = findLoad(src1);
+    Loop::MemCopyCandidate* load2 = findLoad(src2);
+    IR::Opnd *operand = src2;
+    if (!load && load2 && isCommutative)
+    {
+        load = load2;
+        load2 = nullptr;
+        operand = src1;
+    }
+
+    // The operation must consume the most recent loads, each of them once
+    if (!load || load == load2 || (load != loads[0] && load2 != loads[0]) || (load2 && loadCount < 2))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Operands are not the values of the preceding LdElemI"));
+        return false;
+    }
+
+    if (load2 && load->bIndexAlreadyChanged != load2->bIndexAlreadyChanged)
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Index value changed between the ldElems"));
+        return false;
+    }
+
+    BailoutConstantValue constant = { TyIllegal, 0 };
+    StackSym *srcSym = nullptr;
+    if (!load2)
+    {
+        if (operand->IsRegOpnd() &&
+            this->OptIsInvariant(operand->AsRegOpnd(), this->currentBlock, loop, CurrentBlockData()->FindValue(operand->AsRegOpnd()->m_sym), true, true))
+        {
+            srcSym = operand->AsRegOpnd()->GetStackSym();
+        }
+        else if (operand->IsFloatConstOpnd())
+        {
+            constant.InitFloatConstValue(operand->AsFloatConstOpnd()->m_value);
+        }
+        else if (operand->IsIntConstOpnd() && IRType_IsSignedInt(operand->GetType()))
+        {
+            constant.InitIntConstValue(operand->AsIntConstOpnd()->GetValue(), operand->AsIntConstOpnd()->GetType());
+        }
+        else
+        {
+            TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Second operand is neither a LdElemI value nor an invariant"));
+            return false;
+        }
+    }
+
+    Loop::MemArithCandidate* memArithInfo = JitAnewStruct(this->func->GetTopFunc()->m_fg->alloc, Loop::MemArithCandidate);
+    memArithInfo->opcode = instr->m_opcode;
+    memArithInfo->ldBase = load->ldBase;
+    memArithInfo->ldSym = load->transferSym;
+    memArithInfo->ldBase2 = load2 ? load2->ldBase : Js::Constants::InvalidSymID;
+    memArithInfo->ldSym2 = load2 ? load2->transferSym : nullptr;
+    memArithInfo->constant = constant;
+    memArithInfo->srcSym = srcSym;
+    memArithInfo->resultSym = dst->AsRegOpnd()->GetStackSym();
+    memArithInfo->count = 0;
+    memArithInfo->bIndexAlreadyChanged = load->bIndexAlreadyChanged;
+    memArithInfo->base = Js::Constants::InvalidSymID; //need to find the stElem first
+    memArithInfo->index = load->index;
+
+    // The loads are now part of this candidate
+    loop->memOpInfo->candidates->RemoveHead();
+    if (load2)
+    {
+        loop->memOpInfo->candidates->RemoveHead();
+    }
+    loop->memOpInfo->candidates->Prepend(memArithInfo);
+    return true;
+}
+
+bool
+GlobOpt::CollectMemArithStElementI(IR::Instr *instr, Loop *loop)
+{
+    if (!loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        // There is no operation matching this stElem
+        return false;
+    }
+
+    Loop::MemOpCandidate* previousCandidate = loop->memOpInfo->candidates->Head();
+    if (!previousCandidate->IsMemArith())
+    {
+        return false;
+    }
+    Loop::MemArithCandidate* memArithInfo = previousCandidate->AsMemArith();
+
+    Assert(instr->GetDst()->IsIndirOpnd());
+    IR::IndirOpnd *dst = instr->GetDst()->AsIndirOpnd();
+    IR::Opnd *indexOp = dst->GetIndexOpnd();
+    IR::RegOpnd *baseOp = dst->GetBaseOpnd()->AsRegOpnd();
+    SymID baseSymID = GetVarSymID(baseOp->GetStackSym());
+
+    if (!instr->GetSrc1()->IsRegOpnd())
+    {
+        return false;
+    }
+    IR::RegOpnd* src1 = instr->GetSrc1()->AsRegOpnd();
+
+    if (memArithInfo->base != Js::Constants::InvalidSymID || GetVarSymID(memArithInfo->resultSym) != GetVarSymID(src1->GetStackSym()))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("No matching operation found (s%d)"), baseSymID);
+        return false;
+    }
+
+    if (!src1->GetIsDead())
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Source (s%d) is still alive after StElemI"), baseSymID);
+        return false;
+    }
+
+    // The runtime helper only handles typed arrays
+    if (!baseOp->GetValueType().IsTypedIntOrFloatArray() || !IsAllowedForMemOpt(instr, false, baseOp, indexOp))
+    {
+        return false;
+    }
+
+    // Integer arrays need an integer operand, otherwise the helper would always fail
+    const ObjectType objectType = baseOp->GetValueType().GetObjectType();
+    if (objectType != ObjectType::Float32Array && objectType != ObjectType::Float64Array &&
+        (memArithInfo->constant.type == TyFloat64 || (memArithInfo->srcSym && memArithInfo->srcSym->IsFloat64())))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Float operand for an integer array"));
+        return false;
+    }
+
+    Assert(indexOp->GetStackSym());
+    SymID inductionSymID = GetVarSymID(indexOp->GetStackSym());
+    Assert(IsSymIDInductionVariable(inductionSymID, loop));
+    bool isIndexPreIncr = loop->memOpInfo->inductionVariableChangeInfoMap->ContainsKey(inductionSymID);
+    if (isIndexPreIncr != memArithInfo->bIndexAlreadyChanged)
+    {
+        // The index changed between the loads and the store
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Index value changed between ldElem and stElem"));
+        return false;
+    }
+
+    memArithInfo->count++;
+    memArithInfo->base = baseSymID;
+
+    return true;
+}
+
 bool
 GlobOpt::CollectMemOpLdElementI(IR::Instr *instr, Loop *loop)
 {
     Assert(instr->m_opcode == Js::OpCode::LdElemI_A);
-    return (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyLdElementI(instr, loop));
+    // Loads are collected as memcopy candidates, which element-wise memops consume when they find the operation
+    return (!PHASE_OFF(Js::MemCopyPhase, this->func) || !PHASE_OFF(Js::MemArithPhase, this->func)) && CollectMemcopyLdElementI(instr, loop);
 }
 
 bool
@@ -2100,7 +2334,8 @@ GlobOpt::CollectMemOpStElementI(IR::Instr *instr, Loop *loop)
     Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict);
     Assert(instr->GetSrc1());
     return (!PHASE_OFF(Js::MemSetPhase, this->func) && CollectMemsetStElementI(instr, loop)) ||
-        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop));
+        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop)) ||
+        (!PHASE_OFF(Js::MemArithPhase, this->func) && CollectMemArithStElementI(instr, loop));
 }
 
 bool
@@ -2230,6 +2465,19 @@ GlobOpt::CollectMemOpInfo(IR::Instr *instrBegin, IR::Instr *instr, Value *src1Va
         }
         // Fallthrough if not an induction variable
     }
+    case Js::OpCode::Mul_A:
+    case Js::OpCode::Mul_I4:
+        if (this->currentBlock != loop->GetHeadBlock())
+        {
+            // Outside of the loop header, arithmetic is only allowed as the operation of an element-wise memop
+            if (!CollectMemArithInstr(instrBegin, instr, loop, src1Val, src2Val))
+            {
+                loop->doMemOp = false;
+                return false;
+            }
+            break;
+        }
+        // Fallthrough
     default:
         FOREACH_INSTR_IN_RANGE(chkInstr, instrBegin->m_next, instr)
         {
@@ -2256,6 +2504,16 @@ GlobOpt::CollectMemOpInfo(IR::Instr *instrBegin, IR::Instr *instr, Value *src1Va
                         }
                     }
                 }
+                else if (prevCandidate->IsMemArith())
+                {
+                    Loop::MemArithCandidate* memArithCandidate = prevCandidate->AsMemArith();
+                    if (memArithCandidate->base == Js::Constants::InvalidSymID && chkInstr->HasSymUse(memArithCandidate->resultSym))
+                    {
+                        loop->doMemOp = false;
+                        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, chkInstr, _u("Found illegal use of the operation value(s%d)"), GetVarSymID(memArithCandidate->resultSym));
+                        return false;
+                    }
+                }
             }
         }
         NEXT_INSTR_IN_RANGE;
@@ -16713,11 +16971,16 @@ void
 GlobOpt::RemoveMemOpSrcInstr(IR::Instr* memopInstr, IR::Instr* srcInstr, BasicBlock* block)
 {
     Assert(srcInstr && (srcInstr->m_opcode == Js::OpCode::LdElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict));
-    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset));
+    Assert(memopInstr && memopInstr->IsMemOpInstr());
     Assert(block);
     const bool isDst = srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict;
     IR::RegOpnd* opnd = (isDst ? memopInstr->GetDst() : memopInstr->GetSrc1())->AsIndirOpnd()->GetBaseOpnd();
     IR::ArrayRegOpnd* arrayOpnd = opnd->IsArrayRegOpnd() ? opnd->AsArrayRegOpnd() : nullptr;
+    if (!isDst && arrayOpnd && srcInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->m_sym != opnd->m_sym)
+    {
+        // The second load of an element-wise memop is passed as a plain operand
+        arrayOpnd = nullptr;
+    }
 
     IR::Instr* topInstr = srcInstr;
     if (srcInstr->extractedUpperBoundCheckWithoutHoisting)
@@ -16840,7 +17103,10 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     IR::IndirOpnd* dstOpnd = IR::IndirOpnd::New(baseOpnd, startIndexOpnd, dstType, localFunc);
 
     IR::Opnd *src1;
+    IR::Opnd *src2 = sizeOpnd;
+    Js::OpCode memopOpcode = Js::OpCode::Memcopy;
     const bool isMemset = emitData->candidate->IsMemSet();
+    const bool isMemArith = emitData->candidate->IsMemArith();
 
     // Get the source according to the memop type
     if (isMemset)
@@ -16857,6 +17123,69 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
         {
             src1 = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc), IR::AddrOpndKindConstantAddress, localFunc);
         }
+        memopOpcode = Js::OpCode::Memset;
+    }
+    else if (isMemArith)
+    {
+        MemArithEmitData* data = (MemArithEmitData*)emitData;
+        const Loop::MemArithCandidate* candidate = data->candidate->AsMemArith();
+        Assert(data->ldElemInstr && data->arithInstr);
+
+        IR::RegOpnd *srcBaseOpnd = nullptr;
+        IR::RegOpnd *srcIndexOpnd = nullptr;
+        IRType srcType;
+        GetMemOpSrcInfo(loop, data->ldElemInstr, srcBaseOpnd, srcIndexOpnd, srcType);
+        Assert(GetVarSymID(srcIndexOpnd->GetStackSym()) == GetVarSymID(indexOpnd->GetStackSym()));
+        src1 = IR::IndirOpnd::New(srcBaseOpnd, startIndexOpnd, srcType, localFunc);
+
+        // The second operand is either the other array, an invariant sym or a constant
+        IR::RegOpnd *operandOpnd;
+        if (data->ldElemInstr2)
+        {
+            IR::RegOpnd *operandBaseOpnd = data->ldElemInstr2->GetSrc1()->AsIndirOpnd()->GetBaseOpnd();
+            operandOpnd = IR::RegOpnd::New(operandBaseOpnd->m_sym, TyVar, localFunc);
+            operandOpnd->SetValueType(operandBaseOpnd->GetValueType());
+        }
+        else if (candidate->srcSym)
+        {
+            operandOpnd = IR::RegOpnd::New(candidate->srcSym, candidate->srcSym->GetType(), localFunc);
+        }
+        else
+        {
+            operandOpnd = IR::RegOpnd::New(TyVar, localFunc);
+            IR::Instr *ldOperandInstr = IR::Instr::New(Js::OpCode::Ld_A, operandOpnd,
+                IR::AddrOpnd::New(candidate->constant.ToVar(localFunc), IR::AddrOpndKindConstantAddress, localFunc), localFunc);
+            insertBeforeInstr->InsertBefore(ldOperandInstr);
+        }
+        operandOpnd->SetIsJITOptimizedReg(true);
+
+        IR::RegOpnd *sizeRegOpnd;
+        if (sizeOpnd->IsRegOpnd())
+        {
+            sizeRegOpnd = sizeOpnd->AsRegOpnd();
+        }
+        else
+        {
+            sizeRegOpnd = IR::RegOpnd::New(sizeOpnd->GetType(), localFunc);
+            insertBeforeInstr->InsertBefore(IR::Instr::New(Js::OpCode::Ld_I4, sizeRegOpnd, sizeOpnd, localFunc));
+        }
+        src2 = IR::ListOpnd::New(localFunc, operandOpnd, sizeRegOpnd);
+
+        switch (candidate->opcode)
+        {
+        case Js::OpCode::Add_A:
+        case Js::OpCode::Add_I4:
+            memopOpcode = Js::OpCode::Memadd;
+            break;
+        case Js::OpCode::Sub_A:
+        case Js::OpCode::Sub_I4:
+            memopOpcode = Js::OpCode::Memsub;
+            break;
+        default:
+            Assert(candidate->opcode == Js::OpCode::Mul_A || candidate->opcode == Js::OpCode::Mul_I4);
+            memopOpcode = Js::OpCode::Memmul;
+            break;
+        }
     }
     else
     {
@@ -16876,10 +17205,10 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     }
 
     // Generate memcopy
-    IR::Instr* memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
+    IR::Instr* memopInstr = IR::BailOutInstr::New(memopOpcode, bailOutKind, bailOutInfo, localFunc);
     memopInstr->SetDst(dstOpnd);
     memopInstr->SetSrc1(src1);
-    memopInstr->SetSrc2(sizeOpnd);
+    memopInstr->SetSrc2(src2);
     insertBeforeInstr->InsertBefore(memopInstr);
 
 #if DBG_DUMP
@@ -16938,6 +17267,20 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
                               loopCountBuf,
                               bIndexAlreadyChanged);
         }
+        else if (isMemArith)
+        {
+            const Loop::MemArithCandidate* candidate = emitData->candidate->AsMemArith();
+            TRACE_MEMOP_PHASE(MemArith, loop, emitData->stElemInstr,
+                              _u("ValueType: %S, Operation: %s, StBase: s%u, Index: s%u, LdBase: s%u, LdBase2: s%d, LoopCount: %s, IsIndexChangedBeforeUse: %d"),
+                              valueTypeStr,
+                              Js::OpCodeUtil::GetOpCodeName(memopOpcode),
+                              candidate->base,
+                              candidate->index,
+                              candidate->ldBase,
+                              candidate->ldBase2,
+                              loopCountBuf,
+                              bIndexAlreadyChanged);
+        }
         else
         {
             const Loop::MemCopyCandidate* candidate = emitData->candidate->AsMemCopy();
@@ -16955,7 +17298,17 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
 #endif
 
     RemoveMemOpSrcInstr(memopInstr, emitData->stElemInstr, emitData->block);
-    if (!isMemset)
+    if (isMemArith)
+    {
+        MemArithEmitData* data = (MemArithEmitData*)emitData;
+        this->ConvertToByteCodeUses(data->arithInstr);
+        RemoveMemOpSrcInstr(memopInstr, data->ldElemInstr, emitData->block);
+        if (data->ldElemInstr2)
+        {
+            RemoveMemOpSrcInstr(memopInstr, data->ldElemInstr2, emitData->block);
+        }
+    }
+    else if (!isMemset)
     {
         RemoveMemOpSrcInstr(memopInstr, ((MemCopyEmitData*)emitData)->ldElemInstr, emitData->block);
     }
@@ -17045,6 +17398,85 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
     return false;
 }
 
+bool
+GlobOpt::InspectInstrForMemArithCandidate(Loop* loop, IR::Instr* instr, MemArithEmitData* emitData, bool& errorInInstr)
+{
+    Assert(emitData && emitData->candidate && emitData->candidate->IsMemArith());
+    Loop::MemArithCandidate* candidate = (Loop::MemArithCandidate*)emitData->candidate;
+    if (instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict)
+    {
+        if (
+            !emitData->stElemInstr &&
+            instr->GetDst()->IsIndirOpnd() &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym()) == candidate->base) &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym()) == candidate->index)
+            )
+        {
+            Assert(instr->IsProfiledInstr());
+            emitData->stElemInstr = instr;
+            emitData->bailOutKind = instr->GetBailOutKind();
+            // Still need to find the operation and the LdElems
+            return false;
+        }
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Orphan StElemI_A detected"));
+        errorInInstr = true;
+    }
+    else if (instr->m_opcode == Js::OpCode::LdElemI_A)
+    {
+        if (
+            emitData->arithInstr &&
+            instr->GetDst()->IsRegOpnd() &&
+            instr->GetSrc1()->IsIndirOpnd() &&
+            (GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym()) == candidate->index)
+            )
+        {
+            Assert(instr->IsProfiledInstr());
+            const SymID dstSymID = GetVarSymID(instr->GetDst()->AsRegOpnd()->GetStackSym());
+            const SymID baseSymID = GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym());
+            IR::Instr** ldElemInstr = nullptr;
+            if (!emitData->ldElemInstr && dstSymID == GetVarSymID(candidate->ldSym) && baseSymID == candidate->ldBase)
+            {
+                ldElemInstr = &emitData->ldElemInstr;
+            }
+            else if (candidate->ldSym2 && !emitData->ldElemInstr2 && dstSymID == GetVarSymID(candidate->ldSym2) && baseSymID == candidate->ldBase2)
+            {
+                ldElemInstr = &emitData->ldElemInstr2;
+            }
+
+            if (ldElemInstr)
+            {
+                // The helper requires all the arrays to be of the same type
+                ValueType stValueType = emitData->stElemInstr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+                ValueType ldValueType = instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+                if (stValueType != ldValueType)
+                {
+                    TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Mismatch in Load and Store value type"));
+                    errorInInstr = true;
+                    return false;
+                }
+                *ldElemInstr = instr;
+
+                // We found all the instructions for this candidate once the loads are found
+                return emitData->ldElemInstr && (!candidate->ldSym2 || emitData->ldElemInstr2);
+            }
+        }
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Orphan LdElemI_A detected"));
+        errorInInstr = true;
+    }
+    else if (
+        emitData->stElemInstr &&
+        !emitData->arithInstr &&
+        instr->GetDst() &&
+        instr->GetDst()->IsRegOpnd() &&
+        instr->GetDst()->AsRegOpnd()->GetStackSym() == candidate->resultSym
+        )
+    {
+        Assert(instr->m_opcode == candidate->opcode);
+        emitData->arithInstr = instr;
+    }
+    return false;
+}
+
 // The caller is responsible to free the memory allocated between inOrderEmitData[iEmitData -> end]
 bool
 GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitData** inOrderEmitData, int& iEmitData)
@@ -17096,9 +17528,19 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
                 Assert(!PHASE_OFF(Js::MemSetPhase, this->func));
                 emitData = JitAnew(this->alloc, MemSetEmitData);
             }
+            else if (candidate->IsMemArith())
+            {
+                Assert(!PHASE_OFF(Js::MemArithPhase, this->func));
+                if (candidate->base == Js::Constants::InvalidSymID)
+                {
+                    TRACE_MEMOP_PHASE(MemArith, loop, nullptr, _u("(s%d): no matching stElem"), candidate->base);
+                    return false;
+                }
+                emitData = JitAnew(this->alloc, MemArithEmitData);
+            }
             else
             {
-                Assert(!PHASE_OFF(Js::MemCopyPhase, this->func));
+                Assert(!PHASE_OFF(Js::MemCopyPhase, this->func) || !PHASE_OFF(Js::MemArithPhase, this->func));
                 // Specific check for memcopy
                 Assert(candidate->IsMemCopy());
                 Loop::MemCopyCandidate* memcopyCandidate = candidate->AsMemCopy();
@@ -17120,6 +17562,8 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
         bool errorInInstr = false;
         bool candidateFound = candidate->IsMemSet() ?
             InspectInstrForMemSetCandidate(loop, instr, (MemSetEmitData*)emitData, errorInInstr)
+            : candidate->IsMemArith() ?
+            InspectInstrForMemArithCandidate(loop, instr, (MemArithEmitData*)emitData, errorInInstr)
             : InspectInstrForMemCopyCandidate(loop, instr, (MemCopyEmitData*)emitData, errorInInstr);
         if (errorInInstr)
         {
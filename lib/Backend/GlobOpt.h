@@ -645,6 +645,8 @@ class GlobOpt
     bool                    CollectMemcopyStElementI(IR::Instr *, Loop *);
     bool                    CollectMemOpLdElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyLdElementI(IR::Instr *, Loop *);
+    bool                    CollectMemArithInstr(IR::Instr *, IR::Instr *, Loop *, Value *, Value *);
+    bool                    CollectMemArithStElementI(IR::Instr *, Loop *);
     SymID                   GetVarSymID(StackSym *);
     const InductionVariable* GetInductionVariable(SymID, Loop *);
     bool                    IsSymIDInductionVariable(SymID, Loop *);
@@ -653,6 +655,7 @@ class GlobOpt
     void                    ProcessMemOp();
     bool                    InspectInstrForMemSetCandidate(Loop* loop, IR::Instr* instr, struct MemSetEmitData* emitData, bool& errorInInstr);
     bool                    InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, struct MemCopyEmitData* emitData, bool& errorInInstr);
+    bool                    InspectInstrForMemArithCandidate(Loop* loop, IR::Instr* instr, struct MemArithEmitData* emitData, bool& errorInInstr);
     bool                    ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) struct MemOpEmitData** emitData, int& iEmitData);
     void                    EmitMemop(Loop * loop, LoopCount *loopCount, const struct MemOpEmitData* emitData);
     IR::Opnd*               GenerateInductionVariableChangeForMemOp(Loop *loop, byte unroll, IR::Instr *insertBeforeInstr = nullptr);
@@ -206,6 +206,7 @@ class Instr
     bool            IsRealInstr() const;
     bool            IsInlined() const;
     bool            IsNewScObjectInstr() const;
+    bool            IsMemOpInstr() const;
     bool            IsInvalidInstr() const;
     Instr*          GetInvalidInstr();
 
@@ -285,6 +285,22 @@ Instr::IsNewScObjectInstr() const
     return this->m_opcode == Js::OpCode::NewScObject || this->m_opcode == Js::OpCode::NewScObjectNoCtor;
 }
 
+inline bool
+Instr::IsMemOpInstr() const
+{
+    switch (this->m_opcode)
+    {
+    case Js::OpCode::Memset:
+    case Js::OpCode::Memcopy:
+    case Js::OpCode::Memadd:
+    case Js::OpCode::Memsub:
+    case Js::OpCode::Memmul:
+        return true;
+    default:
+        return false;
+    }
+}
+
 inline bool
 Instr::IsInvalidInstr() const
 {
@@ -213,6 +213,7 @@ HELPERCALLCHK(Op_DeleteElementI_Int32, Js::JavascriptOperators::OP_DeleteElement
 
 HELPERCALLCHK(Op_Memset, Js::JavascriptOperators::OP_Memset, AttrCanThrow | AttrCanNotBeReentrant)
 HELPERCALLCHK(Op_Memcopy, Js::JavascriptOperators::OP_Memcopy, AttrCanThrow | AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_MemArith, Js::JavascriptOperators::OP_MemArith, AttrCanNotBeReentrant)
 
 HELPERCALLCHK(Op_PatchGetValue, ((Js::Var (*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId))Js::JavascriptOperators::PatchGetValue<true, Js::InlineCache>), AttrCanThrow)
 HELPERCALLCHK(Op_PatchGetValueWithThisPtr, ((Js::Var(*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId, Js::Var))Js::JavascriptOperators::PatchGetValueWithThisPtr<true, Js::InlineCache>), AttrCanThrow)
@@ -249,8 +249,7 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
             }
             
             if ((bailoutKind & IR::BailOutOnArrayAccessHelperCall) != 0 &&
-                instr->m_opcode != Js::OpCode::Memcopy &&
-                instr->m_opcode != Js::OpCode::Memset)
+                !instr->IsMemOpInstr())
             {
                 this->helperCallCheckState = (HelperCallCheckState)(this->helperCallCheckState | HelperCallCheckState_NoHelperCalls);
             }
@@ -1590,6 +1589,9 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
         case Js::OpCode::Memset:
         case Js::OpCode::Memcopy:
+        case Js::OpCode::Memadd:
+        case Js::OpCode::Memsub:
+        case Js::OpCode::Memmul:
         {
             instrPrev = LowerMemOp(instr);
             break;
@@ -9581,10 +9583,72 @@ Lowerer::LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet)
     return nullptr;
 }
 
+IR::Instr *
+Lowerer::LowerMemArith(IR::Instr * instr, IR::RegOpnd * helperRet)
+{
+    IR::Opnd * dst = instr->UnlinkDst();
+    IR::Opnd * src = instr->UnlinkSrc1();
+    IR::Opnd * list = instr->UnlinkSrc2();
+
+    Assert(dst->IsIndirOpnd());
+    Assert(src->IsIndirOpnd());
+    Assert(list->IsListOpnd() && list->AsListOpnd()->Count() == 2);
+
+    IR::Opnd *dstBaseOpnd = dst->AsIndirOpnd()->UnlinkBaseOpnd();
+    IR::Opnd *dstIndexOpnd = dst->AsIndirOpnd()->UnlinkIndexOpnd();
+
+    IR::Opnd *srcBaseOpnd = src->AsIndirOpnd()->UnlinkBaseOpnd();
+    IR::Opnd *srcIndexOpnd = src->AsIndirOpnd()->UnlinkIndexOpnd();
+
+    // The operand is either the base of a second array or a number
+    IR::Opnd *operandOpnd = list->AsListOpnd()->Item(0)->Copy(m_func);
+    IR::Opnd *sizeOpnd = list->AsListOpnd()->Item(1)->Copy(m_func);
+
+    Js::JavascriptOperators::MemArithOperation operation;
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::Memadd:
+        operation = Js::JavascriptOperators::MemArithAdd;
+        break;
+    case Js::OpCode::Memsub:
+        operation = Js::JavascriptOperators::MemArithSub;
+        break;
+    default:
+        Assert(instr->m_opcode == Js::OpCode::Memmul);
+        operation = Js::JavascriptOperators::MemArithMul;
+        break;
+    }
+
+    IR::Instr *instrPrev = nullptr;
+    if (!operandOpnd->IsVar())
+    {
+        IR::RegOpnd* varOpnd = IR::RegOpnd::New(TyVar, instr->m_func);
+        instrPrev = IR::Instr::New(Js::OpCode::ToVar, varOpnd, operandOpnd, instr->m_func);
+        instr->InsertBefore(instrPrev);
+        operandOpnd = varOpnd;
+    }
+
+    instr->SetDst(helperRet);
+    LoadScriptContext(instr);
+    m_lowererMD.LoadHelperArgument(instr, sizeOpnd);
+    m_lowererMD.LoadHelperArgument(instr, operandOpnd);
+    m_lowererMD.LoadHelperArgument(instr, srcIndexOpnd);
+    m_lowererMD.LoadHelperArgument(instr, srcBaseOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstIndexOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstBaseOpnd);
+    m_lowererMD.LoadHelperArgument(instr, IR::IntConstOpnd::New(operation, TyInt32, m_func));
+    m_lowererMD.ChangeToHelperCall(instr, IR::HelperOp_MemArith);
+    dst->Free(m_func);
+    src->Free(m_func);
+    list->Free(m_func);
+
+    return instrPrev;
+}
+
 IR::Instr *
 Lowerer::LowerMemOp(IR::Instr * instr)
 {
-    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->IsMemOpInstr());
     IR::Instr *instrPrev = instr->m_prev;
 
     IR::RegOpnd* helperRet = IR::RegOpnd::New(TyInt8, instr->m_func);
@@ -9650,6 +9714,10 @@ Lowerer::LowerMemOp(IR::Instr * instr)
     {
         newInstrPrev = LowerMemcopy(instr, helperRet);
     }
+    else
+    {
+        newInstrPrev = LowerMemArith(instr, helperRet);
+    }
 
     if (newInstrPrev != nullptr)
     {
@@ -12859,7 +12927,7 @@ void Lowerer::LowerBailOnInvalidatedArrayHeadSegment(IR::Instr *const instr, con
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->IsMemOpInstr());
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -12986,7 +13054,7 @@ void Lowerer::LowerBailOnInvalidatedArrayLength(IR::Instr *const instr, const bo
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->IsMemOpInstr());
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -13073,7 +13141,7 @@ void Lowerer::LowerBailOnCreatedMissingValue(IR::Instr *const instr, const bool
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->IsMemOpInstr());
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -1740,6 +1740,13 @@ NativeCodeGenerator::CheckCodeGenDone(
             entryPointInfo->GetNativeEntrypoint());
         jsMethod = entryPointInfo->jsMethod;
 
+        if (entryPointInfo->GetJitMode() == ExecutionMode::FullJit && functionBody->HasExecutionDynamicProfileInfo())
+        {
+            // Remember in the profile that this function made it to full JIT, so that a later run that loads the
+            // persisted profile can skip straight to full JIT (see FunctionBody::LoadDynamicProfileInfo)
+            functionBody->GetAnyDynamicProfileInfo()->SetWasFullJitted();
+        }
+
         Assert(!functionBody->NeedEnsureDynamicProfileInfo() || jsMethod == Js::DynamicProfileInfo::EnsureDynamicProfileInfoThunk || functionBody->GetIsAsmjsMode());
         if (functionBody->GetIsAsmjsMode() && functionBody->NeedEnsureDynamicProfileInfo())
         {
@@ -2016,6 +2023,37 @@ NativeCodeGenerator::UpdateQueueForDebugMode()
     }
 }
 
+void
+NativeCodeGenerator::JobProcessing(JsUtil::Job *const job)
+{
+    // This function is called from inside the lock, right after the job was removed from the job processor's queue
+
+    Assert(job);
+
+    CodeGenWorkItem *const workItem = static_cast<CodeGenWorkItem *>(job);
+    Js::FunctionBody *const body = workItem->GetFunctionBody();
+    const int64 queueWaitMicroseconds = job->GetQueueWaitTime().ToMicroseconds();
+
+#ifdef BGJIT_STATS
+    Js::ScriptContext *const scriptContext = workItem->GetScriptContext();
+    scriptContext->jitQueueWaitCount++;
+    scriptContext->jitQueueWaitMicroseconds += queueWaitMicroseconds;
+    scriptContext->maxJitQueueWaitMicroseconds = max(scriptContext->maxJitQueueWaitMicroseconds, queueWaitMicroseconds);
+#endif
+
+    if (PHASE_TRACE(Js::BGJitPhase, body))
+    {
+        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+        Output::Print(
+            _u("BGJit queue wait - function: %s (%s), mode: %S, wait: %8.6f mSec\n"),
+            body->GetDisplayName(),
+            body->GetDebugNumberSet(debugStringBuffer),
+            ExecutionModeName(workItem->GetJitMode()),
+            queueWaitMicroseconds / 1000.0);
+        Output::Flush();
+    }
+}
+
 void
 NativeCodeGenerator::JobProcessed(JsUtil::Job *const job, const bool succeeded)
 {
@@ -76,6 +76,7 @@ void SetProfileMode(BOOL fSet);
     void BeforeWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     void AfterWaitForJob(Js::EntryPointInfo *const entryPoint) const;
     static bool WorkItemExceedsJITLimits(CodeGenWorkItem *const codeGenWork);
+    virtual void JobProcessing(JsUtil::Job *const job) override;
     virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override;
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
     JsUtil::Job *GetJobToProcessProactively();
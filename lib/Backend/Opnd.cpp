@@ -2366,7 +2366,8 @@ ListOpnd::ListOpnd(Func* func, __in_ecount(_count) ListOpndType** _opnds, int _c
     Opnd(), m_func(func), count(_count)
 {
     AssertOrFailFast(count > 0);
-    Assert(func->isPostLower || func->IsInPhase(Js::LowererPhase));
+    // Element-wise memops, created at the end of the global optimizer, are the only users before lowering
+    Assert(func->isPostLower || func->IsInPhase(Js::LowererPhase) || func->IsInPhase(Js::GlobOptPhase));
     m_kind = OpndKindList;
     m_type = TyMisc;
 
@@ -1181,11 +1181,11 @@ LowererMDArch::LowerAsmJsLdElemHelper(IR::Instr * instr, bool isSimdLoad /*= fal
     }
 #endif
 
-#ifdef _WIN32
+#if ENABLE_FAST_ARRAYBUFFER
     // For x64, bound checks are required only for SIMD loads.
     if (isSimdLoad)
 #else
-    // xplat: Always do bound check. We don't support out-of-bound access violation recovery.
+    // Always do bound check. Out-of-bound access violation recovery is not supported on this platform.
     if (true)
 #endif
     {
@@ -1275,11 +1275,11 @@ LowererMDArch::LowerAsmJsStElemHelper(IR::Instr * instr, bool isSimdStore /*= fa
 
     Assert(isSimdStore == false || dataWidth == 4 || dataWidth == 8 || dataWidth == 12 || dataWidth == 16);
 
-#ifdef _WIN32
+#if ENABLE_FAST_ARRAYBUFFER
     // For x64, bound checks are required only for SIMD loads.
     if (isSimdStore)
 #else
-    // xplat: Always do bound check. We don't support out-of-bound access violation recovery.
+    // Always do bound check. Out-of-bound access violation recovery is not supported on this platform.
     if (true)
 #endif
     {
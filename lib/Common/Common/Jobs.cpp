@@ -24,6 +24,7 @@
 #include "Common/Event.h"
 #include "Common/ThreadService.h"
 #include "Common/Jobs.h"
+#include "Common/RoundRobinJobSelector.h"
 #include "Common/Jobs.inl"
 #include "Core/CommonMinMax.h"
 #include "Memory/RecyclerWriteBarrierManager.h"
@@ -60,18 +61,23 @@ namespace JsUtil
         return isCritical;
     }
 
+    Js::TickDelta Job::GetQueueWaitTime() const
+    {
+        return Js::Tick::Now() - queuedTime;
+    }
+
     // -------------------------------------------------------------------------------------------------------------------------
     // JobManager
     // -------------------------------------------------------------------------------------------------------------------------
 
     JobManager::JobManager(JobProcessor *const processor)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(false)
+        : processor(processor), numJobsAddedToProcessor(0), lastScheduledStamp(0), isWaitable(false)
     {
         Assert(processor);
     }
 
     JobManager::JobManager(JobProcessor *const processor, const bool isWaitable)
-        : processor(processor), numJobsAddedToProcessor(0), isWaitable(isWaitable)
+        : processor(processor), numJobsAddedToProcessor(0), lastScheduledStamp(0), isWaitable(isWaitable)
     {
         Assert(processor);
     }
@@ -310,6 +316,7 @@ namespace JsUtil
         if (job->Manager()->numJobsAddedToProcessor + 1 == 0)
             Js::Throw::OutOfMemory();  // Overflow: job counts we use are int32's.
         ++job->Manager()->numJobsAddedToProcessor;
+        job->queuedTime = Js::Tick::Now();
 
         if (prioritize)
             jobs.LinkToBeginning(job);
@@ -331,6 +338,18 @@ namespace JsUtil
         return true;
     }
 
+    void JobProcessor::MoveJobToFront(Job *const job)
+    {
+        // This function is called from inside the lock
+
+        Assert(job);
+        Assert(managers.Contains(job->Manager()));
+        Assert(!IsClosed());
+        Assert(jobs.Contains(job));
+
+        jobs.MoveToBeginning(job);
+    }
+
     void JobProcessor::JobProcessed(JobManager *const manager, Job *const job, const bool succeeded)
     {
         Assert(manager);
@@ -640,7 +659,9 @@ namespace JsUtil
         threadId(GetCurrentThreadContextId()),
         threadService(threadService),
         threadCount(0),
-        maxThreadCount(0)
+        maxThreadCount(0),
+        schedulingStamp(0),
+        isFairSchedulingEnabled(!PHASE_OFF1(Js::BGJitFairSchedulingPhase))
 #if PDATA_ENABLED && defined(_WIN32)
         ,hasExtraWork(0)
 #endif
@@ -856,6 +877,26 @@ namespace JsUtil
         return currentJob;
     }
 
+    Job * BackgroundJobProcessor::UnlinkNextJobToProcess()
+    {
+        Assert(criticalSection.IsLocked());
+
+        Job *nextJob = jobs.Head();
+        if (!nextJob)
+        {
+            return nullptr;
+        }
+
+        // Critical jobs left in the queue after Close are processed in order
+        if (isFairSchedulingEnabled && !IsClosed())
+        {
+            nextJob = RoundRobinJobSelector::SelectJob(nextJob, MaxFairSchedulingScanCount, schedulingStamp);
+        }
+
+        jobs.Unlink(nextJob);
+        return nextJob;
+    }
+
     ParallelThreadData * BackgroundJobProcessor::GetThreadDataFromCurrentJob(Job* job)
     {
         Assert(criticalSection.IsLocked());
@@ -1094,7 +1135,7 @@ namespace JsUtil
             criticalSection.Enter();
             while (!IsClosed() || (jobs.Head() && jobs.Head()->IsCritical()))
             {
-                Job *job = jobs.UnlinkFromBeginning();
+                Job *job = UnlinkNextJobToProcess();
 
                 if(!job)
                 {
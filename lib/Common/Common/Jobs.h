@@ -26,6 +26,7 @@ namespace JsUtil
     class ForegroundJobProcessor;
 #if ENABLE_BACKGROUND_JOB_PROCESSOR
     class BackgroundJobProcessor;
+    class RoundRobinJobSelector;
 #endif
     struct ParallelThreadData;
 
@@ -39,6 +40,7 @@ namespace JsUtil
     {
         friend SingleJobManager;
         friend WaitableSingleJobManager;
+        friend JobProcessor;
 
     private:
         JobManager *manager;
@@ -49,6 +51,9 @@ namespace JsUtil
         // JobManager::JobProcessed(succeeded = false).
         const bool isCritical;
 
+        // Time at which the job was last added to a job processor's queue, used to account for the time jobs spend waiting
+        Js::Tick queuedTime;
+
     private:
         Job(const bool isCritical = false);
     public:
@@ -70,6 +75,9 @@ namespace JsUtil
     public:
         JobManager *Manager() const;
         bool IsCritical() const;
+
+        // Time spent in the job processor's queue so far. Meaningful from inside JobManager::JobProcessing.
+        Js::TickDelta GetQueueWaitTime() const;
     };
 
     // -------------------------------------------------------------------------------------------------------------------------
@@ -86,12 +94,17 @@ namespace JsUtil
         friend ForegroundJobProcessor;
 #if ENABLE_BACKGROUND_JOB_PROCESSOR
         friend BackgroundJobProcessor;
+        friend RoundRobinJobSelector;
 #endif
 
     private:
         JobProcessor *const processor;
         unsigned int numJobsAddedToProcessor;
 
+        // Value of the job processor's scheduling stamp when a job of this manager was last picked for processing. The
+        // background job processor uses this to round-robin between job managers that have jobs queued.
+        uint64 lastScheduledStamp;
+
         // Only job managers derived from WaitableJobManager support waiting for a job or the job manager's queued jobs
         const bool isWaitable;
 
@@ -345,6 +358,9 @@ namespace JsUtil
         // Must be called from inside the lock
         virtual bool RemoveJob(Job *const job);
 
+        // Moves an already queued job to the front of the queue. Must be called from inside the lock.
+        void MoveJobToFront(Job *const job);
+
         // Must be called from inside the lock
         template<class Fn> void ForEachJob(Fn fn);
 
@@ -460,6 +476,12 @@ namespace JsUtil
         unsigned int maxThreadCount;
         ParallelThreadData **parallelThreadData;
 
+        // Round-robin scheduling between job managers, so that one job manager flooding the queue does not starve the
+        // others. Only this many jobs from the front of the queue are considered when picking the next job.
+        static const unsigned int MaxFairSchedulingScanCount = 32;
+        uint64 schedulingStamp;
+        bool isFairSchedulingEnabled;
+
 #if PDATA_ENABLED && defined(_WIN32)
         LONG hasExtraWork;
 #endif
@@ -487,6 +509,7 @@ namespace JsUtil
         bool AreAllThreadsWaitingForJobs();
         uint NumberOfThreadsWaitingForJobs ();
         Job* GetCurrentJobOfManager(JobManager *const manager);
+        Job* UnlinkNextJobToProcess();
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
 
         void InitializeThreadCount();
@@ -0,0 +1,42 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JsUtil
+{
+    // -------------------------------------------------------------------------------------------------------------------------
+    // RoundRobinJobSelector
+    //
+    // Picks the next job for the background job processor so that one job manager flooding the queue does not starve the
+    // others. Out of the first jobs in the queue, the first job of the job manager that was least recently scheduled is picked,
+    // so jobs of one job manager are still processed in the order in which the job manager queued or prioritized them.
+    //
+    // TJob needs Next() and Manager(), and the manager a lastScheduledStamp field.
+    // -------------------------------------------------------------------------------------------------------------------------
+
+    class RoundRobinJobSelector
+    {
+    public:
+        template <class TJob>
+        static TJob * SelectJob(TJob *const head, const unsigned int scanLimit, uint64 &schedulingStamp)
+        {
+            Assert(head);
+            Assert(scanLimit != 0);
+
+            TJob *selectedJob = head;
+            unsigned int scanCount = 1;
+            for (TJob *job = head->Next(); job && scanCount < scanLimit; job = job->Next(), ++scanCount)
+            {
+                if (job->Manager()->lastScheduledStamp < selectedJob->Manager()->lastScheduledStamp)
+                {
+                    selectedJob = job;
+                }
+            }
+
+            selectedJob->Manager()->lastScheduledStamp = ++schedulingStamp;
+            return selectedJob;
+        }
+    };
+}
@@ -186,25 +186,22 @@
 
 #ifndef ENABLE_VALGRIND
 #define ENABLE_CONCURRENT_GC 1
-#ifdef _WIN32
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 1 // Only takes effect when ENABLE_CONCURRENT_GC is enabled.
 #else
-#define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 0 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
-#endif
-#else
 #define ENABLE_CONCURRENT_GC 0
 #define ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP 0 // Needs ENABLE_CONCURRENT_GC to be enabled for this to be enabled.
 #endif
 
+// Interlocked SLIST API; xplat implementation is in CommonPal.h
+#define SUPPORT_WIN32_SLIST 1
+
 #ifdef _WIN32
 #define SYSINFO_IMAGE_BASE_AVAILABLE 1
-#define SUPPORT_WIN32_SLIST 1
 #ifndef CHAKRACORE_LITE
 #define ENABLE_JS_ETW                               // ETW support
 #endif
 #else
 #define SYSINFO_IMAGE_BASE_AVAILABLE 0
-#define SUPPORT_WIN32_SLIST 0
 #endif
 
 #ifdef CHAKRACORE_LITE
@@ -221,6 +218,16 @@
 #define USE_STATIC_VPM 0
 #endif
 
+// Interpreter loop dispatch through a table of label addresses (GCC/Clang labels-as-values),
+// with the dispatch replicated at the end of every opcode handler
+#ifndef ENABLE_INTERPRETER_THREADED_DISPATCH
+#if defined(__GNUC__) || defined(__clang__)
+#define ENABLE_INTERPRETER_THREADED_DISPATCH 1
+#else
+#define ENABLE_INTERPRETER_THREADED_DISPATCH 0
+#endif
+#endif
+
 
 #if ENABLE_CONCURRENT_GC
 // Write-barrier refers to a software write barrier implementation using a card table.
@@ -311,7 +318,8 @@
 #endif
 
 // ToDo (SaAgarwa): Disable VirtualTypedArray on ARM64 till we make sure it works correctly
-#if defined(_WIN32) && defined(TARGET_64) && !defined(_M_ARM64)
+// On Linux, out of bounds accesses are recovered from the PAL's SIGSEGV handler (see JavascriptFunction::HardwareExceptionHandler)
+#if (defined(_WIN32) || defined(__linux__)) && defined(TARGET_64) && !defined(_M_ARM64)
 #define ENABLE_FAST_ARRAYBUFFER 1
 #endif
 #endif
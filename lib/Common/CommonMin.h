@@ -46,6 +46,7 @@ using namespace Memory;
 
 // === Data structures Header Files ===
 #include "DataStructures/QuickSort.h"
+#include "DataStructures/TimSort.h"
 #include "DataStructures/DefaultContainerLockPolicy.h"
 #include "DataStructures/Comparer.h"
 #include "DataStructures/SizePolicy.h"
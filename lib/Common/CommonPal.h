@@ -390,9 +390,102 @@ typedef union _SLIST_HEADER {
 
 #endif
 
-PALIMPORT VOID PALAPI InitializeSListHead(IN OUT PSLIST_HEADER ListHead);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY  ListEntry);
-PALIMPORT PSLIST_ENTRY PALAPI InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead);
+//
+// xplat implementation of the interlocked SLIST API.
+//
+// The SLIST_HEADER layout above is opaque to callers, so we overlay our own
+// header on it: the first entry, the depth and a small spin lock. Holding the
+// lock for the push/pop keeps us clear of the ABA problem without needing a
+// double-width compare-exchange, which is not available on all our targets.
+// Lists are only touched when a heap block or page run changes hands, so the
+// lock is rarely contended.
+//
+typedef struct _PAL_SLIST_HEADER {
+  PSLIST_ENTRY Next;
+  USHORT Depth;
+  USHORT volatile Lock;
+} PAL_SLIST_HEADER, *PPAL_SLIST_HEADER;
+
+static_assert(sizeof(PAL_SLIST_HEADER) <= sizeof(SLIST_HEADER), "PAL_SLIST_HEADER must fit in SLIST_HEADER");
+
+inline void PAL_AcquireSListLock(PPAL_SLIST_HEADER header)
+{
+    while (__sync_lock_test_and_set(&header->Lock, (USHORT)1) != 0)
+    {
+        while (header->Lock != 0)
+        {
+            YieldProcessor();
+        }
+    }
+}
+
+inline void PAL_ReleaseSListLock(PPAL_SLIST_HEADER header)
+{
+    __sync_lock_release(&header->Lock);
+}
+
+inline VOID InitializeSListHead(IN OUT PSLIST_HEADER ListHead)
+{
+    memset(ListHead, 0, sizeof(SLIST_HEADER));
+}
+
+inline PSLIST_ENTRY InterlockedPushEntrySList(IN OUT PSLIST_HEADER ListHead, IN OUT PSLIST_ENTRY ListEntry)
+{
+    PPAL_SLIST_HEADER header = (PPAL_SLIST_HEADER)ListHead;
+    PAL_AcquireSListLock(header);
+    PSLIST_ENTRY first = header->Next;
+    ListEntry->Next = first;
+    header->Next = ListEntry;
+    header->Depth++;
+    PAL_ReleaseSListLock(header);
+    return first;
+}
+
+inline PSLIST_ENTRY InterlockedPopEntrySList(IN OUT PSLIST_HEADER ListHead)
+{
+    PPAL_SLIST_HEADER header = (PPAL_SLIST_HEADER)ListHead;
+    PAL_AcquireSListLock(header);
+    PSLIST_ENTRY first = header->Next;
+    if (first != nullptr)
+    {
+        header->Next = first->Next;
+        header->Depth--;
+    }
+    PAL_ReleaseSListLock(header);
+    return first;
+}
+
+inline PSLIST_ENTRY InterlockedFlushSList(IN OUT PSLIST_HEADER ListHead)
+{
+    PPAL_SLIST_HEADER header = (PPAL_SLIST_HEADER)ListHead;
+    PAL_AcquireSListLock(header);
+    PSLIST_ENTRY first = header->Next;
+    header->Next = nullptr;
+    header->Depth = 0;
+    PAL_ReleaseSListLock(header);
+    return first;
+}
+
+inline USHORT QueryDepthSList(IN PSLIST_HEADER ListHead)
+{
+    // Like the Windows API, this is only a snapshot and may be stale by the time it is used.
+    return ((PPAL_SLIST_HEADER)ListHead)->Depth;
+}
+
+inline void * _aligned_malloc(size_t size, size_t alignment)
+{
+    void * memblock = nullptr;
+    if (posix_memalign(&memblock, alignment, size) != 0)
+    {
+        return nullptr;
+    }
+    return memblock;
+}
+
+inline void _aligned_free(void * memblock)
+{
+    free(memblock);
+}
 
 
 template <class T>
@@ -14,6 +14,7 @@
 #endif
 PHASE(All)
     PHASE(BGJit)
+        PHASE(BGJitFairScheduling)
     PHASE(Module)
     PHASE(LibInit)
         PHASE(JsLibInit)
@@ -204,6 +205,7 @@ PHASE(All)
                 PHASE(MemOp)
                     PHASE(MemSet)
                     PHASE(MemCopy)
+                    PHASE(MemArith)
                 PHASE(IncrementalBailout)
             PHASE(DeadStore)
                 PHASE(ReverseCopyProp)
@@ -296,6 +298,7 @@ PHASE(All)
                 PHASE(BackgroundFinishMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
+                PHASE(ParallelMarkSteal)
             PHASE(PartialCollect)
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
@@ -321,6 +324,7 @@ PHASE(All)
         PHASE(BailOut)
         PHASE(RegexQc)
         PHASE(RegexOptBT)
+        PHASE(RegexTierUp)
         PHASE(InlineCache)
         PHASE(PolymorphicInlineCache)
         PHASE(MissingPropertyCache)
@@ -343,6 +347,7 @@ PHASE(All)
         PHASE(InlineSlots)
 #endif
         PHASE(DynamicProfile)
+            PHASE(ProfileBasedFullJit)
 #ifdef DYNAMIC_PROFILE_STORAGE
         PHASE(DynamicProfileStorage)
 #endif
@@ -362,6 +367,7 @@ PHASE(All)
         PHASE(XDataAllocator)
         PHASE(PageAllocator)
         PHASE(StringConcat)
+        PHASE(OneByteString)
 #if DBG_DUMP
         PHASE(PRNG)
 #endif
@@ -799,8 +805,10 @@ PHASE(All)
 #define DEFAULT_CONFIG_InduceCodeGenFailure (30) // When -InduceCodeGenFailure is passed in, 30% of JIT allocations will fail
 
 #define DEFAULT_CONFIG_SkipSplitWhenResultIgnored (false)
+#define DEFAULT_CONFIG_RegexTierUpThreshold (16)
 
 #define DEFAULT_CONFIG_MinMemOpCount (16U)
+#define DEFAULT_CONFIG_TypedArraySortParallelThreshold (1U << 20)
 
 #if ENABLE_COPYONACCESS_ARRAY
 #define DEFAULT_CONFIG_MaxCopyOnAccessArrayLength (32U)
@@ -1064,6 +1072,7 @@ FLAGNR(Boolean, ExecuteByteCodeBufferReturnsInvalidByteCode, "Serialized byte co
 FLAGR(Number, ExpirableCollectionGCCount, "Number of GCs during which Expirable object profiling occurs", DEFAULT_CONFIG_ExpirableCollectionGCCount)
 FLAGR (Number,  ExpirableCollectionTriggerThreshold, "Threshold at which Expirable Object Collection is triggered (In Percentage)", DEFAULT_CONFIG_ExpirableCollectionTriggerThreshold)
 FLAGR(Boolean, SkipSplitOnNoResult, "If the result of Regex split isn't used, skip executing the regex. (Perf optimization)", DEFAULT_CONFIG_SkipSplitWhenResultIgnored)
+FLAGR(Number, RegexTierUpThreshold, "Number of matches after which a regex that never backtracks is converted to a linear program", DEFAULT_CONFIG_RegexTierUpThreshold)
 #ifdef TEST_ETW_EVENTS
 FLAGNR(String,  TestEtwDll            , "Path of the TestEtwEventSink DLL", nullptr)
 #endif
@@ -1321,6 +1330,7 @@ FLAGNR(Number,  MinSimpleJitRunCount  , "Minimum number of times a function must
 FLAGNRA(Number, MaxInterpretCount     , Mic, "Maximum number of times a function can be interpreted", 0)
 FLAGNRA(Number, MaxSimpleJitRunCount  , Msjrc, "Maximum number of times a function will be run in SimpleJitted code", 0)
 FLAGNRA(Number, MinMemOpCount         , Mmoc, "Minimum count of a loop to activate MemOp", DEFAULT_CONFIG_MinMemOpCount)
+FLAGNR(Number,  TypedArraySortParallelThreshold, "Minimum length of a typed array sorted in parallel on the background job processor when no comparator is given", DEFAULT_CONFIG_TypedArraySortParallelThreshold)
 
 #if ENABLE_COPYONACCESS_ARRAY
 FLAGNR(Number,  MaxCopyOnAccessArrayLength, "Maximum length of copy-on-access array", DEFAULT_CONFIG_MaxCopyOnAccessArrayLength)
@@ -15,6 +15,26 @@ class PageStack
     static const size_t EntriesPerChunk = (AutoSystemInfo::PageSize - sizeof(Chunk)) / sizeof(T);
 
 public:
+    // Full chunks that a stack has handed off for other stacks to take during parallel marking.
+    // The owner donates a chunk when it fills one and its queue has run dry, and any stack that runs
+    // out of work can take one from any queue. Only whole chunks move, so Push/Pop stay lock free.
+    class StealQueue
+    {
+    public:
+        StealQueue() : head(nullptr), count(0) {}
+        ~StealQueue() { Assert(IsEmpty()); }
+
+        bool IsEmpty() const { return head == nullptr; }
+        uint Count() const { return count; }
+
+    private:
+        Chunk * volatile head;
+        uint count;
+        CriticalSection lock;
+
+        friend class PageStack<T>;
+    };
+
     PageStack(PagePool * pagePool);
     ~PageStack();
 
@@ -26,6 +46,9 @@ class PageStack
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
 
+    void SetStealQueue(StealQueue * stealQueue) { this->stealQueue = stealQueue; }
+    bool Steal(StealQueue * victimQueue);
+
     void Abort();
     void Release();
 
@@ -49,6 +72,7 @@ class PageStack
 private:
     Chunk * CreateChunk();
     void FreeChunk(Chunk * chunk);
+    bool ShouldDonateCurrentChunk() const;
 
 private:
     T * nextEntry;
@@ -56,6 +80,7 @@ class PageStack
     T * chunkEnd;
     Chunk * currentChunk;
     PagePool * pagePool;
+    StealQueue * stealQueue;
     bool usesReservedPages;
 
 #if DBG
@@ -121,7 +146,30 @@ bool PageStack<T>::Push(T item)
             return false;
         }
 
-        newChunk->nextChunk = currentChunk;
+        if (ShouldDonateCurrentChunk())
+        {
+            // Hand the full chunk to whoever runs out of work first and keep going on a fresh one.
+            Chunk * fullChunk = currentChunk;
+            newChunk->nextChunk = fullChunk->nextChunk;
+
+            {
+                AutoCriticalSection autoLock(&stealQueue->lock);
+                fullChunk->nextChunk = stealQueue->head;
+                stealQueue->head = fullChunk;
+                stealQueue->count++;
+            }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+            pageCount--;
+#endif
+#if DBG
+            count -= EntriesPerChunk;
+#endif
+        }
+        else
+        {
+            newChunk->nextChunk = currentChunk;
+        }
         currentChunk = newChunk;
 
         chunkStart = currentChunk->entries;
@@ -146,6 +194,7 @@ bool PageStack<T>::Push(T item)
 template <typename T>
 PageStack<T>::PageStack(PagePool * pagePool) :
     pagePool(pagePool),
+    stealQueue(nullptr),
     currentChunk(nullptr),
     nextEntry(nullptr),
     chunkStart(nullptr),
@@ -241,6 +290,68 @@ void PageStack<T>::FreeChunk(Chunk * chunk)
 }
 
 
+template <typename T>
+inline
+bool PageStack<T>::ShouldDonateCurrentChunk() const
+{
+    // Only donate when nobody has picked up our last donation yet; that keeps the lock traffic
+    // proportional to the number of hungry stacks rather than to the number of chunks we fill.
+    // Reserved pages stay with their stack so it can always make progress on OOM rescan.
+    return this->stealQueue != nullptr
+        && this->stealQueue->IsEmpty()
+        && !this->currentChunk->IsReserved();
+}
+
+
+template <typename T>
+bool PageStack<T>::Steal(StealQueue * victimQueue)
+{
+    // Take one full chunk from [victimQueue] and make it the current chunk of this stack.
+    // This stack must be empty.
+
+    Assert(IsEmpty());
+
+    if (victimQueue->IsEmpty())
+    {
+        return false;
+    }
+
+    Chunk * chunk;
+    {
+        AutoCriticalSection autoLock(&victimQueue->lock);
+        chunk = victimQueue->head;
+        if (chunk == nullptr)
+        {
+            return false;
+        }
+        victimQueue->head = chunk->nextChunk;
+        victimQueue->count--;
+    }
+
+    // Drop our empty preallocated chunk; the stolen one will serve as it once we have drained it.
+    if (currentChunk != nullptr)
+    {
+        Assert(currentChunk->nextChunk == nullptr);
+        FreeChunk(currentChunk);
+    }
+
+    chunk->nextChunk = nullptr;
+    currentChunk = chunk;
+    chunkStart = chunk->entries;
+    chunkEnd = &chunk->entries[EntriesPerChunk];
+    nextEntry = chunkEnd;
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+    pageCount = 1;
+#endif
+#if DBG
+    count = EntriesPerChunk;
+#endif
+
+    return true;
+}
+
+
 template <typename T>
 uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks)
 {
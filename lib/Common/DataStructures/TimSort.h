@@ -0,0 +1,635 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+namespace JsUtil
+{
+    // A stable, adaptive merge sort (TimSort). Runs that are already in order are found and kept (strictly
+    // descending runs are reversed), short runs are extended with a binary insertion sort, and runs are
+    // merged with a galloping search once one of them keeps winning, so that sorted and partially sorted
+    // input takes close to n comparisons.
+    //
+    // The comparer returns a negative number, zero or a positive number, and may throw. Elements are only
+    // ever moved, never copied, within the array, except while a merge keeps part of a run in the temporary
+    // buffer; if the comparer throws then, the buffered elements are put back into the gap so that the
+    // array still holds every element exactly once.
+    //
+    // Elements are moved with assignments, so that types with write barriers are handled. The caller
+    // provides a temporary buffer of at least GetTempBufferLength(length) elements, which must be visible to
+    // the GC if the elements are GC pointers.
+    template <typename T, typename TComparer>
+    class TimSort
+    {
+    public:
+        // Short arrays are sorted by insertion and need no buffer
+        static uint32 GetTempBufferLength(uint32 length)
+        {
+            return length < MinMerge ? 0 : length / 2 + 1;
+        }
+
+        static void Sort(T* elements, uint32 length, T* temp, const TComparer& comparer)
+        {
+            TimSort sort(elements, temp, comparer);
+            sort.Sort(length);
+        }
+
+    private:
+        // Runs shorter than this are built with a binary insertion sort
+        static const uint32 MinMerge = 32;
+        // Number of consecutive wins by one run before switching to galloping
+        static const uint32 InitialMinGallop = 7;
+        // The run lengths on the stack grow at least as fast as the Fibonacci numbers, so this is enough for 2^32 elements
+        static const uint32 MaxRunCount = 49;
+
+        T* elements;
+        T* temp;
+        const TComparer& comparer;
+        uint32 minGallop;
+        uint32 runCount;
+        uint32 runBase[MaxRunCount];
+        uint32 runLength[MaxRunCount];
+
+        TimSort(T* elements, T* temp, const TComparer& comparer) :
+            elements(elements), temp(temp), comparer(comparer), minGallop(InitialMinGallop), runCount(0)
+        {
+        }
+
+        bool IsLess(const T& a, const T& b) const
+        {
+            return comparer(a, b) < 0;
+        }
+
+        static void MoveForward(T* dst, const T* src, uint32 count)
+        {
+            // dst is before src, or the ranges do not overlap
+            for (uint32 i = 0; i < count; i++)
+            {
+                dst[i] = src[i];
+            }
+        }
+
+        static void MoveBackward(T* dst, const T* src, uint32 count)
+        {
+            // dst is after src, or the ranges do not overlap
+            for (uint32 i = count; i > 0; i--)
+            {
+                dst[i - 1] = src[i - 1];
+            }
+        }
+
+        // Copies the elements still in the temporary buffer back into the gap they leave in the array, when the
+        // merge completes and also when the comparer throws. The gap starts at dest when merging from the low
+        // end, and ends right before dest when merging from the high end.
+        class MergeGap
+        {
+        private:
+            T*& dest;
+            T*& buffered;
+            uint32& count;
+            bool isHigh;
+
+        public:
+            MergeGap(T*& dest, T*& buffered, uint32& count, bool isHigh) : dest(dest), buffered(buffered), count(count), isHigh(isHigh) { }
+            ~MergeGap()
+            {
+                MoveForward(isHigh ? dest - count : dest, buffered, count);
+            }
+        };
+
+        void Sort(uint32 length)
+        {
+            if (length < 2)
+            {
+                return;
+            }
+
+            if (length < MinMerge)
+            {
+                const uint32 runLength = CountRunAndMakeAscending(0, length);
+                BinaryInsertionSort(0, length, runLength);
+                return;
+            }
+
+            const uint32 minRun = GetMinRunLength(length);
+            uint32 low = 0;
+            uint32 remaining = length;
+            do
+            {
+                uint32 runLength = CountRunAndMakeAscending(low, low + remaining);
+                if (runLength < minRun)
+                {
+                    const uint32 forcedLength = min(remaining, minRun);
+                    BinaryInsertionSort(low, low + forcedLength, runLength);
+                    runLength = forcedLength;
+                }
+
+                PushRun(low, runLength);
+                MergeCollapse();
+
+                low += runLength;
+                remaining -= runLength;
+            } while (remaining != 0);
+
+            MergeForceCollapse();
+            Assert(runCount == 1 && this->runLength[0] == length);
+        }
+
+        static uint32 GetMinRunLength(uint32 length)
+        {
+            // A value in [MinMerge / 2, MinMerge] such that length / minRun is a power of two or just below one
+            uint32 lowBits = 0;
+            while (length >= MinMerge)
+            {
+                lowBits |= (length & 1);
+                length >>= 1;
+            }
+            return length + lowBits;
+        }
+
+        // Returns the length of the run starting at low, reversing it if it is strictly descending
+        uint32 CountRunAndMakeAscending(uint32 low, uint32 high)
+        {
+            Assert(low < high);
+            uint32 runHigh = low + 1;
+            if (runHigh == high)
+            {
+                return 1;
+            }
+
+            if (IsLess(elements[runHigh++], elements[low]))
+            {
+                while (runHigh < high && IsLess(elements[runHigh], elements[runHigh - 1]))
+                {
+                    runHigh++;
+                }
+                Reverse(low, runHigh);
+            }
+            else
+            {
+                while (runHigh < high && !IsLess(elements[runHigh], elements[runHigh - 1]))
+                {
+                    runHigh++;
+                }
+            }
+            return runHigh - low;
+        }
+
+        void Reverse(uint32 low, uint32 high)
+        {
+            for (high--; low < high; low++, high--)
+            {
+                T element = elements[low];
+                elements[low] = elements[high];
+                elements[high] = element;
+            }
+        }
+
+        // Sorts [low, high), of which [low, start) is already sorted
+        void BinaryInsertionSort(uint32 low, uint32 high, uint32 start)
+        {
+            for (start = max(start, low + 1); start < high; start++)
+            {
+                T pivot = elements[start];
+
+                // Insert after the elements equal to the pivot, to keep the sort stable
+                uint32 left = low;
+                uint32 right = start;
+                while (left < right)
+                {
+                    const uint32 middle = left + (right - left) / 2;
+                    if (IsLess(pivot, elements[middle]))
+                    {
+                        right = middle;
+                    }
+                    else
+                    {
+                        left = middle + 1;
+                    }
+                }
+
+                MoveBackward(elements + left + 1, elements + left, start - left);
+                elements[left] = pivot;
+            }
+        }
+
+        void PushRun(uint32 base, uint32 length)
+        {
+            AnalysisAssert(runCount < MaxRunCount);
+            runBase[runCount] = base;
+            runLength[runCount] = length;
+            runCount++;
+        }
+
+        // Merges runs until the lengths on the stack satisfy, from the top, len[i - 2] > len[i - 1] + len[i]
+        // and len[i - 1] > len[i], which keeps the merges balanced
+        void MergeCollapse()
+        {
+            while (runCount > 1)
+            {
+                uint32 n = runCount - 2;
+                if ((n > 0 && runLength[n - 1] <= runLength[n] + runLength[n + 1]) ||
+                    (n > 1 && runLength[n - 2] <= runLength[n - 1] + runLength[n]))
+                {
+                    if (runLength[n - 1] < runLength[n + 1])
+                    {
+                        n--;
+                    }
+                }
+                else if (runLength[n] > runLength[n + 1])
+                {
+                    break;
+                }
+                MergeAt(n);
+            }
+        }
+
+        void MergeForceCollapse()
+        {
+            while (runCount > 1)
+            {
+                uint32 n = runCount - 2;
+                if (n > 0 && runLength[n - 1] < runLength[n + 1])
+                {
+                    n--;
+                }
+                MergeAt(n);
+            }
+        }
+
+        // Merges the runs at i and i + 1 of the stack
+        void MergeAt(uint32 i)
+        {
+            Assert(i + 1 < runCount);
+            uint32 base1 = runBase[i];
+            uint32 length1 = runLength[i];
+            const uint32 base2 = runBase[i + 1];
+            uint32 length2 = runLength[i + 1];
+            Assert(base1 + length1 == base2);
+
+            runLength[i] = length1 + length2;
+            if (i + 2 < runCount)
+            {
+                runBase[i + 1] = runBase[i + 2];
+                runLength[i + 1] = runLength[i + 2];
+            }
+            runCount--;
+
+            // Elements of the first run that are not greater than the first element of the second are already in place
+            const uint32 skip = GallopRight(elements[base2], elements + base1, length1, 0);
+            base1 += skip;
+            length1 -= skip;
+            if (length1 == 0)
+            {
+                return;
+            }
+
+            // Elements of the second run that are not less than the last element of the first are already in place
+            length2 = GallopLeft(elements[base1 + length1 - 1], elements + base2, length2, length2 - 1);
+            if (length2 == 0)
+            {
+                return;
+            }
+
+            if (length1 <= length2)
+            {
+                MergeLow(base1, length1, base2, length2);
+            }
+            else
+            {
+                MergeHigh(base1, length1, base2, length2);
+            }
+        }
+
+        // Returns the index in the sorted range where key would go before any equal element, searching outwards
+        // from hint so that the cost is logarithmic in the distance to the answer rather than in the length
+        uint32 GallopLeft(const T& key, const T* range, uint32 length, uint32 hint) const
+        {
+            Assert(length > 0 && hint < length);
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            if (IsLess(range[hint], key))
+            {
+                // Find range[hint + lastOffset] < key <= range[hint + offset]
+                const uint32 maxOffset = length - hint;
+                while (offset < maxOffset && IsLess(range[hint + offset], key))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                return LowerBound(key, range, hint + lastOffset + 1, hint + min(offset, maxOffset));
+            }
+
+            // Find range[hint - offset] < key <= range[hint - lastOffset]
+            const uint32 maxOffset = hint + 1;
+            while (offset < maxOffset && !IsLess(range[hint - offset], key))
+            {
+                lastOffset = offset;
+                offset = NextGallopOffset(offset, maxOffset);
+            }
+            return LowerBound(key, range, hint + 1 - min(offset, maxOffset), hint - lastOffset);
+        }
+
+        // Returns the index in the sorted range where key would go after any equal element, searching outwards from hint
+        uint32 GallopRight(const T& key, const T* range, uint32 length, uint32 hint) const
+        {
+            Assert(length > 0 && hint < length);
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            if (IsLess(key, range[hint]))
+            {
+                // Find range[hint - offset] <= key < range[hint - lastOffset]
+                const uint32 maxOffset = hint + 1;
+                while (offset < maxOffset && IsLess(key, range[hint - offset]))
+                {
+                    lastOffset = offset;
+                    offset = NextGallopOffset(offset, maxOffset);
+                }
+                return UpperBound(key, range, hint + 1 - min(offset, maxOffset), hint - lastOffset);
+            }
+
+            // Find range[hint + lastOffset] <= key < range[hint + offset]
+            const uint32 maxOffset = length - hint;
+            while (offset < maxOffset && !IsLess(key, range[hint + offset]))
+            {
+                lastOffset = offset;
+                offset = NextGallopOffset(offset, maxOffset);
+            }
+            return UpperBound(key, range, hint + lastOffset + 1, hint + min(offset, maxOffset));
+        }
+
+        static uint32 NextGallopOffset(uint32 offset, uint32 maxOffset)
+        {
+            return offset < maxOffset / 2 ? offset * 2 + 1 : maxOffset;
+        }
+
+        // Returns the first index in [low, high) whose element is not less than key, or high
+        uint32 LowerBound(const T& key, const T* range, uint32 low, uint32 high) const
+        {
+            while (low < high)
+            {
+                const uint32 middle = low + (high - low) / 2;
+                if (IsLess(range[middle], key))
+                {
+                    low = middle + 1;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+            return high;
+        }
+
+        // Returns the first index in [low, high) whose element is greater than key, or high
+        uint32 UpperBound(const T& key, const T* range, uint32 low, uint32 high) const
+        {
+            while (low < high)
+            {
+                const uint32 middle = low + (high - low) / 2;
+                if (IsLess(key, range[middle]))
+                {
+                    high = middle;
+                }
+                else
+                {
+                    low = middle + 1;
+                }
+            }
+            return high;
+        }
+
+        // Merges the adjacent runs in place, buffering the first, shorter, run
+        void MergeLow(uint32 base1, uint32 length1, uint32 base2, uint32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+            MoveForward(temp, elements + base1, length1);
+
+            T* cursor1 = temp;
+            T* cursor2 = elements + base2;
+            T* dest = elements + base1;
+            MergeGap gap(dest, cursor1, length1, false);
+
+            *dest++ = *cursor2++;
+            if (--length2 == 0)
+            {
+                return;
+            }
+            if (length1 == 1)
+            {
+                MoveForward(dest, cursor2, length2);
+                dest += length2;
+                return;
+            }
+
+            for (;;)
+            {
+                uint32 count1 = 0;
+                uint32 count2 = 0;
+
+                // Merge one element at a time until one run starts winning consistently
+                do
+                {
+                    Assert(length1 > 1 && length2 > 0);
+                    if (IsLess(*cursor2, *cursor1))
+                    {
+                        *dest++ = *cursor2++;
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        *dest++ = *cursor1++;
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 1)
+                        {
+                            MoveForward(dest, cursor2, length2);
+                            dest += length2;
+                            return;
+                        }
+                    }
+                } while ((count1 | count2) < minGallop);
+
+                // Gallop: find where the next element of each run goes in the other and move whole blocks
+                do
+                {
+                    Assert(length1 > 1 && length2 > 0);
+                    count1 = GallopRight(*cursor2, cursor1, length1, 0);
+                    if (count1 != 0)
+                    {
+                        MoveForward(dest, cursor1, count1);
+                        dest += count1;
+                        cursor1 += count1;
+                        length1 -= count1;
+                        if (length1 <= 1)
+                        {
+                            if (length1 == 1)
+                            {
+                                MoveForward(dest, cursor2, length2);
+                                dest += length2;
+                            }
+                            return;
+                        }
+                    }
+                    *dest++ = *cursor2++;
+                    if (--length2 == 0)
+                    {
+                        return;
+                    }
+
+                    count2 = GallopLeft(*cursor1, cursor2, length2, 0);
+                    if (count2 != 0)
+                    {
+                        MoveForward(dest, cursor2, count2);
+                        dest += count2;
+                        cursor2 += count2;
+                        length2 -= count2;
+                        if (length2 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    *dest++ = *cursor1++;
+                    if (--length1 == 1)
+                    {
+                        MoveForward(dest, cursor2, length2);
+                        dest += length2;
+                        return;
+                    }
+
+                    if (minGallop > 1)
+                    {
+                        minGallop--;
+                    }
+                } while (count1 >= InitialMinGallop || count2 >= InitialMinGallop);
+
+                // Penalize leaving gallop mode
+                minGallop += 2;
+            }
+        }
+
+        // Merges the adjacent runs in place from the end, buffering the second, shorter, run
+        void MergeHigh(uint32 base1, uint32 length1, uint32 base2, uint32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+            MoveForward(temp, elements + base2, length2);
+
+            // The cursors and dest point one past the next element to take or fill. The elements left in the
+            // buffer are always its first length2 ones.
+            T* cursor1 = elements + base1 + length1;
+            T* cursor2 = temp + length2;
+            T* dest = elements + base2 + length2;
+            T* buffered = temp;
+            MergeGap gap(dest, buffered, length2, true);
+
+            *--dest = *--cursor1;
+            if (--length1 == 0)
+            {
+                return;
+            }
+            if (length2 == 1)
+            {
+                dest -= length1;
+                cursor1 -= length1;
+                MoveBackward(dest, cursor1, length1);
+                return;
+            }
+
+            for (;;)
+            {
+                uint32 count1 = 0;
+                uint32 count2 = 0;
+
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    if (IsLess(*(cursor2 - 1), *(cursor1 - 1)))
+                    {
+                        *--dest = *--cursor1;
+                        count1++;
+                        count2 = 0;
+                        if (--length1 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        *--dest = *--cursor2;
+                        count2++;
+                        count1 = 0;
+                        if (--length2 == 1)
+                        {
+                            dest -= length1;
+                            cursor1 -= length1;
+                            MoveBackward(dest, cursor1, length1);
+                            return;
+                        }
+                    }
+                } while ((count1 | count2) < minGallop);
+
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    count1 = length1 - GallopRight(*(cursor2 - 1), cursor1 - length1, length1, length1 - 1);
+                    if (count1 != 0)
+                    {
+                        dest -= count1;
+                        cursor1 -= count1;
+                        length1 -= count1;
+                        MoveBackward(dest, cursor1, count1);
+                        if (length1 == 0)
+                        {
+                            return;
+                        }
+                    }
+                    *--dest = *--cursor2;
+                    if (--length2 == 1)
+                    {
+                        dest -= length1;
+                        cursor1 -= length1;
+                        MoveBackward(dest, cursor1, length1);
+                        return;
+                    }
+
+                    count2 = length2 - GallopLeft(*(cursor1 - 1), cursor2 - length2, length2, length2 - 1);
+                    if (count2 != 0)
+                    {
+                        dest -= count2;
+                        cursor2 -= count2;
+                        length2 -= count2;
+                        MoveForward(dest, cursor2, count2);
+                        if (length2 <= 1)
+                        {
+                            if (length2 == 1)
+                            {
+                                dest -= length1;
+                                cursor1 -= length1;
+                                MoveBackward(dest, cursor1, length1);
+                            }
+                            return;
+                        }
+                    }
+                    *--dest = *--cursor1;
+                    if (--length1 == 0)
+                    {
+                        return;
+                    }
+
+                    if (minGallop > 1)
+                    {
+                        minGallop--;
+                    }
+                } while (count1 >= InitialMinGallop || count2 >= InitialMinGallop);
+
+                minGallop += 2;
+            }
+        }
+    };
+}
@@ -25,6 +25,7 @@ class MarkContext
 
 public:
     static const int MarkCandidateSize = sizeof(MarkCandidate);
+    typedef PageStack<MarkCandidate>::StealQueue MarkStealQueue;
 
     MarkContext(Recycler * recycler, PagePool * pagePool);
     ~MarkContext();
@@ -61,6 +62,10 @@ class MarkContext
 
     uint Split(uint targetCount, __in_ecount(targetCount) MarkContext ** targetContexts);
 
+    // Work stealing between parallel mark contexts. Only the generic mark stack is shared.
+    void SetStealQueue(MarkStealQueue * stealQueue) { markStack.SetStealQueue(stealQueue); }
+    bool StealMarkObjects(MarkStealQueue * victimQueue) { return markStack.Steal(victimQueue); }
+
     void Abort();
     void Release();
 
@@ -10,6 +10,77 @@
 THREAD_LOCAL HRESULT MemoryOperationLastError::MemOpLastError = 0;
 #endif
 
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+uintptr_t volatile JitCodeSegmentReservations::entries[JitCodeSegmentReservations::MaxReservations];
+LONG volatile JitCodeSegmentReservations::entryCount = 0;
+
+bool JitCodeSegmentReservations::Register(void * address, size_t reservationSize)
+{
+    Assert(((uintptr_t)address & GranuleCountMask) == 0);
+    Assert(reservationSize != 0 && (reservationSize & GranuleCountMask) == 0);
+    size_t granuleCount = reservationSize / GranuleSize;
+    if (granuleCount > GranuleCountMask)
+    {
+        return false;
+    }
+    uintptr_t entry = (uintptr_t)address | granuleCount;
+
+    // Claim a free slot; the signal handler never sees a partially written entry
+    for (LONG i = 0; i < MaxReservations; i++)
+    {
+        if (InterlockedCompareExchangePointer((PVOID volatile *)&entries[i], (PVOID)entry, nullptr) == nullptr)
+        {
+            LONG count = entryCount;
+            while (count <= i)
+            {
+                LONG previous = InterlockedCompareExchange(&entryCount, i + 1, count);
+                if (previous == count)
+                {
+                    break;
+                }
+                count = previous;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void JitCodeSegmentReservations::Unregister(void * address)
+{
+    // Removed before the memory is released, so a later reservation at the same address isn't mistaken for this one
+    LONG count = entryCount;
+    for (LONG i = 0; i < count; i++)
+    {
+        if ((entries[i] & ~GranuleCountMask) == (uintptr_t)address)
+        {
+            InterlockedExchangePointer((PVOID volatile *)&entries[i], nullptr);
+            return;
+        }
+    }
+    Assert(UNREACHED);
+}
+
+bool JitCodeSegmentReservations::Contains(uintptr_t address)
+{
+    LONG count = entryCount;
+    for (LONG i = 0; i < count; i++)
+    {
+        uintptr_t entry = entries[i];
+        if (entry == 0)
+        {
+            continue;
+        }
+        uintptr_t base = entry & ~GranuleCountMask;
+        if (address >= base && address - base < (entry & GranuleCountMask) * GranuleSize)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
 //=============================================================================================================
 // Segment
 //=============================================================================================================
@@ -67,6 +138,12 @@ SegmentBase<T>::~SegmentBase()
     if (this->address)
     {
         char* originalAddress = this->address - (leadingGuardPageCount * AutoSystemInfo::PageSize);
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+        if (this->IsInCustomHeapAllocator())
+        {
+            JitCodeSegmentReservations::Unregister(originalAddress);
+        }
+#endif
         GetAllocator()->GetVirtualAllocator()->Free(originalAddress, GetPageCount() * AutoSystemInfo::PageSize, MEM_RELEASE);
         GetAllocator()->ReportFree(this->segmentPageCount * AutoSystemInfo::PageSize); //Note: We reported the guard pages free when we decommitted them during segment initialization
 #if defined(TARGET_64) && defined(RECYCLER_WRITE_BARRIER_BYTE)
@@ -133,6 +210,16 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
 
     Assert( ((ULONG_PTR)this->address % (64 * 1024)) == 0 );
 
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+    if (this->IsInCustomHeapAllocator() && !JitCodeSegmentReservations::Register(this->address, totalPages * AutoSystemInfo::PageSize))
+    {
+        GetAllocator()->GetVirtualAllocator()->Free(this->address, totalPages * AutoSystemInfo::PageSize, MEM_RELEASE);
+        this->GetAllocator()->ReportFailure(totalPages * AutoSystemInfo::PageSize);
+        this->address = nullptr;
+        return false;
+    }
+#endif
+
     originalAddress = this->address;
     bool committed = (allocFlags & MEM_COMMIT) != 0;
     if (addGuardPages)
@@ -159,6 +246,12 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
 
     if (!GetAllocator()->CreateSecondaryAllocator(this, committed, &this->secondaryAllocator))
     {
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+        if (this->IsInCustomHeapAllocator())
+        {
+            JitCodeSegmentReservations::Unregister(originalAddress);
+        }
+#endif
         GetAllocator()->GetVirtualAllocator()->Free(originalAddress,
           GetPageCount() * AutoSystemInfo::PageSize, MEM_RELEASE);
         this->GetAllocator()->ReportFailure(GetPageCount() * AutoSystemInfo::PageSize);
@@ -188,6 +281,12 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
 
     if (!registerBarrierResult)
     {
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+        if (this->IsInCustomHeapAllocator())
+        {
+            JitCodeSegmentReservations::Unregister(originalAddress);
+        }
+#endif
         GetAllocator()->GetVirtualAllocator()->Free(originalAddress,
           GetPageCount() * AutoSystemInfo::PageSize, MEM_RELEASE);
         this->GetAllocator()->ReportFailure(GetPageCount() * AutoSystemInfo::PageSize);
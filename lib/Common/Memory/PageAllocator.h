@@ -122,6 +122,30 @@ class SecondaryAllocator
 
 class PageAllocatorBaseCommon;
 
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+// Table of the segments reserved for the custom heap, i.e. for JIT'd code and thunks. The SIGSEGV handler
+// (see Js::JavascriptFunction::HardwareExceptionHandler) only recovers from faults raised by JIT'd code, and
+// can't take the code page allocator locks, so Contains only reads the table.
+class JitCodeSegmentReservations
+{
+public:
+    static bool Register(void * address, size_t reservationSize);
+    static void Unregister(void * address);
+    static bool Contains(uintptr_t address);
+
+private:
+    // Segments are at least one allocation granule, and usually a few, so this covers GBs of code
+    static const LONG MaxReservations = 16384;
+    // Segments are aligned to and sized in 64KB granules, so an entry packs the granule count into the low bits
+    static const uintptr_t GranuleSize = 64 * 1024;
+    static const uintptr_t GranuleCountMask = GranuleSize - 1;
+
+    static uintptr_t volatile entries[MaxReservations];
+    // Only grows, so Contains never has to scan past the last slot ever used
+    static LONG volatile entryCount;
+};
+#endif
+
 class SegmentBaseCommon
 {
     // Disable create instance of PageAllocatorBaseCommon directly
@@ -513,7 +537,6 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
 
     static size_t GetAndResetMaxUsedBytes();
 
-    // xplat TODO: implement a platform agnostic version of interlocked linked lists
 #if ENABLE_BACKGROUND_PAGE_FREEING
     struct FreePageEntry
 #if SUPPORT_WIN32_SLIST
@@ -148,6 +148,10 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     enableConcurrentMark(false),  // Default to non-concurrent
     enableParallelMark(false),
     enableConcurrentSweep(false),
+    parallelMarkStealQueueCount(0),
+    parallelMarkActiveCount(0),
+    enableParallelMarkSteal(false),
+    isParallelMarkStealing(false),
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     allowAllocationsDuringConcurrentSweepForCollection(false),
 #endif
@@ -2244,14 +2248,19 @@ Recycler::ProcessParallelMark(bool background, MarkContext * markContext)
 
     RECYCLER_PROFILE_EXEC_THREAD_BEGIN(background, this, Js::MarkPhase);
 
-    if (this->enableScanInteriorPointers)
-    {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
-    }
-    else
+    // Once our own work runs out, keep marking with whatever we can steal from the other contexts.
+    do
     {
-        this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        if (this->enableScanInteriorPointers)
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ true>(markContext);
+        }
+        else
+        {
+            this->ProcessMarkContext</* parallel */ true, /* interior */ false>(markContext);
+        }
     }
+    while (this->StealParallelMarkWork(markContext));
 
     RECYCLER_PROFILE_EXEC_THREAD_END(background, this, Js::MarkPhase);
 
@@ -2538,6 +2547,11 @@ Recycler::DoParallelMark()
         StartQueueTrackedObject();
     }
 
+    // Every context that got a piece of the split takes part in work stealing:
+    // parallelMarkContext1 on this thread, markContext on the background thread and the rest on the parallel threads.
+    MarkContext * stealContexts[MaxParallelMarkContexts] = { &parallelMarkContext1, &markContext, &parallelMarkContext2, &parallelMarkContext3 };
+    StartParallelMarkSteal(stealContexts, actualSplitCount + 1);
+
     // Kick off marking on the background thread
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
@@ -2554,42 +2568,51 @@ Recycler::DoParallelMark()
         }
     }
 
+    // Contexts we failed to hand to a thread don't take part in stealing; we process them below.
+    if (!concurrentSuccess)
+    {
+        AbandonParallelMarkSteal();
+    }
+    if (actualSplitCount >= 2 && !parallelSuccess1)
+    {
+        AbandonParallelMarkSteal();
+    }
+    if (actualSplitCount == 3 && !parallelSuccess2)
+    {
+        AbandonParallelMarkSteal();
+    }
+
     // Process our portion of the split.
     this->ProcessParallelMark(false, &parallelMarkContext1);
 
     // If we successfully launched parallel work, wait for it to complete.
-    // If we failed, then process the work in-thread now.
     if (concurrentSuccess)
     {
         WaitForConcurrentThread(INFINITE, RecyclerWaitReason::DoParallelMark);
     }
-    else
+    if (parallelSuccess1)
     {
-        this->ProcessParallelMark(false, &markContext);
+        parallelThread1.WaitForConcurrent();
     }
-
-    if (actualSplitCount >= 2)
+    if (parallelSuccess2)
     {
-        if (parallelSuccess1)
-        {
-            parallelThread1.WaitForConcurrent();
-        }
-        else
-        {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
+        parallelThread2.WaitForConcurrent();
+    }
 
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
-        }
+    EndParallelMarkSteal(stealContexts, actualSplitCount + 1);
+
+    // If we failed to launch parallel work, then process the work in-thread now.
+    if (!concurrentSuccess)
+    {
+        this->ProcessParallelMark(false, &markContext);
+    }
+    if (actualSplitCount >= 2 && !parallelSuccess1)
+    {
+        this->ProcessParallelMark(false, &parallelMarkContext2);
+    }
+    if (actualSplitCount == 3 && !parallelSuccess2)
+    {
+        this->ProcessParallelMark(false, &parallelMarkContext3);
     }
 
     this->SetCollectionState(CollectionStateMark);
@@ -2647,6 +2670,9 @@ Recycler::DoBackgroundParallelMark()
 
     this->SetCollectionState(CollectionStateBackgroundParallelMark);
 
+    MarkContext * stealContexts[3] = { &markContext, &parallelMarkContext2, &parallelMarkContext3 };
+    StartParallelMarkSteal(stealContexts, actualSplitCount + 1);
+
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
     bool parallelSuccess1 = false;
@@ -2657,33 +2683,146 @@ Recycler::DoBackgroundParallelMark()
         parallelSuccess2 = parallelThread2.StartConcurrent();
     }
 
+    if (!parallelSuccess1)
+    {
+        AbandonParallelMarkSteal();
+    }
+    if (actualSplitCount == 2 && !parallelSuccess2)
+    {
+        AbandonParallelMarkSteal();
+    }
+
     // Process our portion of the split.
     this->ProcessParallelMark(true, &markContext);
 
     // If we successfully launched parallel work, wait for it to complete.
-    // If we failed, then process the work in-thread now.
     if (parallelSuccess1)
     {
         parallelThread1.WaitForConcurrent();
     }
-    else
+    if (parallelSuccess2)
+    {
+        parallelThread2.WaitForConcurrent();
+    }
+
+    EndParallelMarkSteal(stealContexts, actualSplitCount + 1);
+
+    // If we failed to launch parallel work, then process the work in-thread now.
+    if (!parallelSuccess1)
     {
         this->ProcessParallelMark(true, &parallelMarkContext2);
     }
+    if (actualSplitCount == 2 && !parallelSuccess2)
+    {
+        this->ProcessParallelMark(true, &parallelMarkContext3);
+    }
 
-    if (actualSplitCount == 2)
+    this->SetCollectionState(CollectionStateConcurrentMark);
+}
+
+void
+Recycler::StartParallelMarkSteal(__in_ecount(contextCount) MarkContext ** contexts, uint contextCount)
+{
+    Assert(!this->isParallelMarkStealing);
+    Assert(contextCount > 1 && contextCount <= MaxParallelMarkContexts);
+
+    if (!this->enableParallelMarkSteal)
+    {
+        return;
+    }
+
+    for (uint i = 0; i < contextCount; i++)
+    {
+        Assert(this->parallelMarkStealQueues[i].IsEmpty());
+        contexts[i]->SetStealQueue(&this->parallelMarkStealQueues[i]);
+    }
+
+    this->parallelMarkStealQueueCount = contextCount;
+    this->parallelMarkActiveCount = contextCount;
+    this->isParallelMarkStealing = true;
+    MemoryBarrier();
+}
+
+void
+Recycler::EndParallelMarkSteal(__in_ecount(contextCount) MarkContext ** contexts, uint contextCount)
+{
+    if (!this->isParallelMarkStealing)
+    {
+        return;
+    }
+
+    // Everyone that took part has seen all the queues empty with no one left marking.
+    Assert(this->parallelMarkActiveCount == 0);
+    Assert(contextCount == this->parallelMarkStealQueueCount);
+
+    for (uint i = 0; i < contextCount; i++)
     {
-        if (parallelSuccess2)
+        Assert(this->parallelMarkStealQueues[i].IsEmpty());
+        contexts[i]->SetStealQueue(nullptr);
+    }
+
+    this->parallelMarkStealQueueCount = 0;
+    this->isParallelMarkStealing = false;
+}
+
+void
+Recycler::AbandonParallelMarkSteal()
+{
+    // A participant we counted on never started; don't wait for it.
+    // Its context has not donated anything since it hasn't been marked yet.
+    if (this->isParallelMarkStealing)
+    {
+        Assert(this->parallelMarkActiveCount > 0);
+        ::InterlockedDecrement(&this->parallelMarkActiveCount);
+    }
+}
+
+bool
+Recycler::StealParallelMarkWork(MarkContext * markContext)
+{
+    if (!this->isParallelMarkStealing)
+    {
+        return false;
+    }
+
+    // We are out of work. We only stop once nobody is marking anymore: until then someone may still donate.
+    ::InterlockedDecrement(&this->parallelMarkActiveCount);
+
+    uint spinCount = 0;
+    while (true)
+    {
+        for (uint i = 0; i < this->parallelMarkStealQueueCount; i++)
         {
-            parallelThread2.WaitForConcurrent();
+            MarkContext::MarkStealQueue * victimQueue = &this->parallelMarkStealQueues[i];
+            if (victimQueue->IsEmpty())
+            {
+                continue;
+            }
+
+            // Count ourselves back in before taking the work so nobody sees us idle while we hold it.
+            ::InterlockedIncrement(&this->parallelMarkActiveCount);
+            if (markContext->StealMarkObjects(victimQueue))
+            {
+                return true;
+            }
+            ::InterlockedDecrement(&this->parallelMarkActiveCount);
+        }
+
+        if (this->parallelMarkActiveCount == 0)
+        {
+            // Every participant has drained its own queue before going idle, so there is nothing left.
+            return false;
+        }
+
+        if (++spinCount < 64)
+        {
+            YieldProcessor();
         }
         else
         {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
+            ::SwitchToThread();
         }
     }
-
-    this->SetCollectionState(CollectionStateConcurrentMark);
 }
 #endif
 
@@ -5072,10 +5211,12 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
 #if ENABLE_DEBUG_CONFIG_OPTIONS
     this->enableConcurrentMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentMarkPhase);
     this->enableParallelMark = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase);
+    this->enableParallelMarkSteal = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkStealPhase);
     this->enableConcurrentSweep = !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ConcurrentSweepPhase);
 #else
     this->enableConcurrentMark = true;
     this->enableParallelMark = true;
+    this->enableParallelMarkSteal = true;
     this->enableConcurrentSweep = true;
 #endif
 
@@ -850,6 +850,18 @@ class Recycler
     PagePool parallelMarkPagePool2;
     PagePool parallelMarkPagePool3;
 
+#if ENABLE_CONCURRENT_GC
+    // Work stealing between the above markContexts while they are marked in parallel.
+    // One queue per participating context; a context that runs dry takes full mark stack chunks
+    // from any of them, and marking is done once every participant is idle and all queues are empty.
+    static const uint MaxParallelMarkContexts = 4;
+    MarkContext::MarkStealQueue parallelMarkStealQueues[MaxParallelMarkContexts];
+    uint parallelMarkStealQueueCount;
+    uint volatile parallelMarkActiveCount;
+    bool enableParallelMarkSteal;
+    bool isParallelMarkStealing;
+#endif
+
     bool IsMarkStackEmpty();
     bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
     bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
@@ -1598,6 +1610,10 @@ class Recycler
 #if ENABLE_CONCURRENT_GC
     void DoParallelMark();
     void DoBackgroundParallelMark();
+    void StartParallelMarkSteal(__in_ecount(contextCount) MarkContext ** contexts, uint contextCount);
+    void EndParallelMarkSteal(__in_ecount(contextCount) MarkContext ** contexts, uint contextCount);
+    void AbandonParallelMarkSteal();
+    bool StealParallelMarkWork(MarkContext * markContext);
 #endif
 
     size_t RootMark(CollectionState markState);
@@ -697,6 +697,11 @@ CHAKRA_API
 ///     The runtime will detach the data from the buffer and hold on to it until all
 ///     instances of any functions created from the buffer are garbage collected.
 ///     </para>
+///     <para>
+///     Byte code and strings are used directly from the buffer and are never written to,
+///     so an ExternalArrayBuffer over a read-only file mapping can be shared between
+///     processes. Functions are only deserialized when they are first called.
+///     </para>
 /// </remarks>
 /// <param name="buffer">The serialized script as an ArrayBuffer (preferably ExternalArrayBuffer).</param>
 /// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
@@ -1271,5 +1276,61 @@ CHAKRA_API
         _In_ JsValueRef parserState,
         _Out_ JsValueRef * result);
 
+/// <summary>
+///     Serializes the dynamic profile data collected for a script so that it can be
+///     given to a later run with <c>JsSetSerializedProfile</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         The profile covers the functions of the script that have executed in the current
+///         script context. It is only valid for the same script source and the same build of
+///         the engine.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">
+///     The cookie the script was run with. <c>JS_SOURCE_CONTEXT_NONE</c> is not supported.
+/// </param>
+/// <param name="buffer">The ArrayBuffer containing the serialized profile.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     Returns <c>JsErrorInvalidArgument</c> if no script was run with the given source context,
+///     no profile data was collected for it or the script has more functions than a profile can cover.
+/// </returns>
+CHAKRA_API
+    JsSerializeProfile(
+        _In_ JsSourceContext sourceContext,
+        _Out_ JsValueRef *buffer);
+
+/// <summary>
+///     Provides the dynamic profile data, serialized by <c>JsSerializeProfile</c> in an earlier run,
+///     for a script that has not been run yet in the current script context.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         The profile is used when a script is later run with the same source context. Functions
+///         start out with the types and call targets seen in the earlier run, which lets the JIT
+///         produce optimized code sooner. Profile data that does not match a function is ignored.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">
+///     The cookie the script will be run with. <c>JS_SOURCE_CONTEXT_NONE</c> is not supported.
+/// </param>
+/// <param name="buffer">The ArrayBuffer containing the serialized profile.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     Returns <c>JsErrorInvalidArgument</c> if a script was already run with the given source
+///     context, or the buffer was not serialized by this version of the engine or is corrupt.
+/// </returns>
+CHAKRA_API
+    JsSetSerializedProfile(
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef buffer);
+
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
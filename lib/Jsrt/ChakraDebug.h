@@ -808,6 +808,54 @@ typedef unsigned __int32 uint32_t;
     CHAKRA_API
         JsTTDStop();
 
+    /// <summary>
+    ///     TTD API -- may change in future versions:
+    ///     Snapshot the current state of all the contexts in a record runtime so they can later be reset to it with JsTTDRestoreStartupSnapshot.
+    ///     A host typically calls this once its contexts are fully initialized (libraries loaded, bootstrap scripts run) and then stops recording.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     Capturing requires the runtime to be a time-travel record runtime created with <c>JsTTDCreateRecordRuntime</c>; for any
+    ///     other runtime, including replay runtimes, this fails with <c>JsErrorInvalidArgument</c>. The runtime therefore carries the
+    ///     recording overhead for its whole lifetime: property records are pinned, contexts are tracked for snapshots and script
+    ///     runs with time-travel instrumentation, and every event is logged while recording is started.
+    ///     </para>
+    ///     <para>
+    ///     The snapshot can be captured while recording and remains available after <c>JsTTDStop</c> unloads the log.
+    ///     </para>
+    ///     <para>
+    ///     The snapshot is kept by the runtime (it is not part of the log) and replaces any previously captured one.
+    ///     </para>
+    /// </remarks>
+    /// <param name="runtimeHandle">The record runtime to snapshot.</param>
+    /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+    CHAKRA_API
+        JsTTDCaptureStartupSnapshot(
+            _In_ JsRuntimeHandle runtimeHandle);
+
+    /// <summary>
+    ///     TTD API -- may change in future versions:
+    ///     Reset all the contexts in a record runtime to the state captured by JsTTDCaptureStartupSnapshot.
+    ///     Built-in library objects and, on repeated restores, unchanged objects are reused rather than re-created, so this is much
+    ///     cheaper than creating and initializing new contexts.
+    /// </summary>
+    /// <remarks>
+    ///     <para>
+    ///     The restore resets the existing contexts in place, it does not create new ones: the <c>JsContextRef</c> handles the host
+    ///     holds stay valid and refer to the reset contexts. This is why every context in the snapshot must still be alive.
+    ///     </para>
+    ///     <para>
+    ///     References the host holds to objects created after the snapshot was captured are not updated by the restore.
+    ///     Fails with <c>JsErrorInvalidArgument</c> if the runtime is not a record runtime, no snapshot was captured or a context in
+    ///     it has since been destroyed.
+    ///     </para>
+    /// </remarks>
+    /// <param name="runtimeHandle">The record runtime to reset.</param>
+    /// <returns>The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.</returns>
+    CHAKRA_API
+        JsTTDRestoreStartupSnapshot(
+            _In_ JsRuntimeHandle runtimeHandle);
+
     /// <summary>
     ///     TTD API -- may change in future versions:
     ///     Pause Time-Travel recording before executing code on behalf of debugger or other diagnostic/telemetry.
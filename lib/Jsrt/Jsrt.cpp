@@ -14,6 +14,7 @@
 #include "Library/DataView.h"
 #include "Library/JavascriptExceptionMetadata.h"
 #include "Library/JavascriptPromise.h"
+#include "Language/SourceDynamicProfileManager.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
 
@@ -4174,6 +4175,65 @@ CHAKRA_API JsTTDStop()
 #endif
 }
 
+CHAKRA_API JsTTDCaptureStartupSnapshot(_In_ JsRuntimeHandle runtimeHandle)
+{
+#if !ENABLE_TTD
+    return JsErrorCategoryUsage;
+#else
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode
+    {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext* threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        if(!threadContext->IsRuntimeInTTDMode() || (threadContext->TTDLog->GetCurrentTTDMode() & TTD::TTDMode::RecordMode) != TTD::TTDMode::RecordMode)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        if(threadContext->IsInScript())
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        threadContext->TTDLog->DoStartupSnapshotExtract();
+
+        return JsNoError;
+    });
+#endif
+}
+
+CHAKRA_API JsTTDRestoreStartupSnapshot(_In_ JsRuntimeHandle runtimeHandle)
+{
+#if !ENABLE_TTD
+    return JsErrorCategoryUsage;
+#else
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode
+    {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext* threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        if(!threadContext->IsRuntimeInTTDMode() || (threadContext->TTDLog->GetCurrentTTDMode() & TTD::TTDMode::RecordMode) != TTD::TTDMode::RecordMode)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        if(threadContext->IsInScript())
+        {
+            return JsErrorRuntimeInUse;
+        }
+
+        if(!threadContext->TTDLog->DoStartupSnapshotInflate())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        threadContext->TTDLog->ResetCallStackForTopLevelCall(-1);
+
+        return JsNoError;
+    });
+#endif
+}
+
 CHAKRA_API JsTTDPauseTimeTravelBeforeRuntimeOperation()
 {
 #if !ENABLE_TTD
@@ -4830,27 +4890,64 @@ CHAKRA_API JsCreateStringUtf16(
 }
 
 
-template <class CopyFunc>
-JsErrorCode WriteStringCopy(
-    JsValueRef value,
-    int start,
-    int length,
-    _Out_opt_ size_t* written,
-    const CopyFunc& copyFunc)
+// Latin-1 characters are all below 0x100, so each one is encoded as one or two UTF-8 bytes
+static size_t CopyLatin1AsUtf8(
+    _In_reads_(count) const char* src,
+    size_t count,
+    _Out_writes_opt_(bufferSize) char* buffer,
+    size_t bufferSize)
 {
-    if (written)
+    const uint8* bytes = reinterpret_cast<const uint8*>(src);
+    size_t encodedLength = 0;
+    for (size_t i = 0; i < count; i++)
     {
-        *written = 0;  // init to 0 for default
+        const uint8 ch = bytes[i];
+        const size_t needed = ch < 0x80 ? 1 : 2;
+        if (buffer)
+        {
+            if (encodedLength + needed > bufferSize)
+            {
+                break;  // only write whole characters
+            }
+
+            if (ch < 0x80)
+            {
+                buffer[encodedLength] = static_cast<char>(ch);
+            }
+            else
+            {
+                buffer[encodedLength] = static_cast<char>(0xC0 | (ch >> 6));
+                buffer[encodedLength + 1] = static_cast<char>(0x80 | (ch & 0x3F));
+            }
+        }
+        encodedLength += needed;
     }
+    return encodedLength;
+}
 
-    const char16* str = nullptr;
-    size_t strLength = 0;
-    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
-    if (errorCode != JsNoError)
+// Returns the one-byte contents of the string if it has not been widened yet
+static const char* TryGetOneByteBuffer(JsValueRef value, _Out_ size_t* length)
+{
+    Js::OneByteString* oneByteString = Js::OneByteString::TryFromVar(value);
+    if (oneByteString == nullptr || oneByteString->GetOneByteBuffer() == nullptr)
     {
-        return errorCode;
+        *length = 0;
+        return nullptr;
     }
 
+    *length = oneByteString->GetLength();
+    return oneByteString->GetOneByteBuffer();
+}
+
+template <class CharType, class CopyFunc>
+JsErrorCode WriteStringCopy(
+    const CharType* str,
+    size_t strLength,
+    int start,
+    int length,
+    _Out_opt_ size_t* written,
+    const CopyFunc& copyFunc)
+{
     if (start < 0 || (size_t)start > strLength)
     {
         return JsErrorInvalidArgument;  // start out of range, no chars written
@@ -4862,7 +4959,7 @@ JsErrorCode WriteStringCopy(
         return JsNoError;  // no chars written
     }
 
-    errorCode = copyFunc(str + start, count, written);
+    JsErrorCode errorCode = copyFunc(str + start, count, written);
     if (errorCode != JsNoError)
     {
         return errorCode;
@@ -4876,6 +4973,30 @@ JsErrorCode WriteStringCopy(
     return JsNoError;
 }
 
+template <class CopyFunc>
+JsErrorCode WriteStringCopy(
+    JsValueRef value,
+    int start,
+    int length,
+    _Out_opt_ size_t* written,
+    const CopyFunc& copyFunc)
+{
+    if (written)
+    {
+        *written = 0;  // init to 0 for default
+    }
+
+    const char16* str = nullptr;
+    size_t strLength = 0;
+    JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
+    if (errorCode != JsNoError)
+    {
+        return errorCode;
+    }
+
+    return WriteStringCopy(str, strLength, start, length, written, copyFunc);
+}
+
 CHAKRA_API JsCopyStringUtf16(
     _In_ JsValueRef value,
     _In_ int start,
@@ -4906,6 +5027,18 @@ CHAKRA_API JsCopyString(
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
 
+    size_t oneByteLength = 0;
+    const char* oneByteBuffer = TryGetOneByteBuffer(value, &oneByteLength);
+    if (oneByteBuffer != nullptr)
+    {
+        size_t utf8Length = CopyLatin1AsUtf8(oneByteBuffer, oneByteLength, buffer, bufferSize);
+        if (length)
+        {
+            *length = utf8Length;
+        }
+        return JsNoError;
+    }
+
     const char16* str = nullptr;
     size_t strLength = 0;
     JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
@@ -5432,6 +5565,27 @@ CHAKRA_API JsCopyStringOneByte(
 {
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
+
+    size_t oneByteLength = 0;
+    const char* oneByteBuffer = TryGetOneByteBuffer(value, &oneByteLength);
+    if (oneByteBuffer != nullptr)
+    {
+        if (written)
+        {
+            *written = 0;  // init to 0 for default
+        }
+
+        return WriteStringCopy(oneByteBuffer, oneByteLength, start, length, written,
+            [buffer](const char* src, size_t count, size_t *needed)
+        {
+            if (buffer)
+            {
+                memmove(buffer, src, count);
+            }
+            return JsNoError;
+        });
+    }
+
     return WriteStringCopy(value, start, length, written,
         [buffer](const char16* src, size_t count, size_t *needed)
     {
@@ -5777,4 +5931,73 @@ CHAKRA_API JsRunScriptWithParserState(
         buffer, arrayBuffer, sourceContext, url, false, true, result, sourceIndex);
 }
 
+CHAKRA_API JsSerializeProfile(
+    _In_ JsSourceContext sourceContext,
+    _Out_ JsValueRef *buffer)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(buffer);
+        *buffer = nullptr;
+
+        if (sourceContext == JS_SOURCE_CONTEXT_NONE)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+#if ENABLE_PROFILE_INFO
+        SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(sourceContext, nullptr);
+        if (sourceContextInfo == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        uint bufferSize = Js::SourceDynamicProfileManager::SaveToBuffer(sourceContextInfo, scriptContext, nullptr, 0);
+        if (bufferSize == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer * arrayBuffer = scriptContext->GetLibrary()->CreateArrayBuffer(bufferSize);
+        if (Js::SourceDynamicProfileManager::SaveToBuffer(sourceContextInfo, scriptContext, arrayBuffer->GetBuffer(), bufferSize) != bufferSize)
+        {
+            return JsErrorFatal;
+        }
+
+        *buffer = arrayBuffer;
+        return JsNoError;
+#else
+        return JsErrorNotImplemented;
+#endif
+    });
+}
+
+CHAKRA_API JsSetSerializedProfile(
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef buffer)
+{
+    VALIDATE_JSREF(buffer);
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        if (sourceContext == JS_SOURCE_CONTEXT_NONE || !Js::ArrayBuffer::Is(buffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+#if ENABLE_PROFILE_INFO
+        Js::ArrayBuffer * arrayBuffer = Js::ArrayBuffer::FromVar(buffer);
+        Js::SourceDynamicProfileManager * profileManager = Js::SourceDynamicProfileManager::LoadFromBuffer(
+            arrayBuffer->GetBuffer(), arrayBuffer->GetByteLength(), scriptContext->GetRecycler());
+
+        if (profileManager == nullptr || !scriptContext->SetHostProvidedProfile(sourceContext, profileManager))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        return JsNoError;
+#else
+        return JsErrorNotImplemented;
+#endif
+    });
+}
+
 #endif // _CHAKRACOREBUILD
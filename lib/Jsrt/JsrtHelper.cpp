@@ -127,6 +127,9 @@ void JsrtCallbackState::ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollect
 
 #ifndef _WIN32
         PAL_InitializeChakraCore();
+#if ENABLE_FAST_ARRAYBUFFER
+        PAL_SetHardwareExceptionHandler(Js::JavascriptFunction::HardwareExceptionHandler);
+#endif
 #endif
 
         HMODULE mod = GetModuleHandleW(NULL);
@@ -157,6 +157,23 @@ BGParseWorkItem* BGParseManager::FindJob(DWORD dwCookie, bool waitForResults, bo
             {
                 Processor()->RemoveJob(matchedWorkitem);
             }
+            else if (waitForResults && matchedWorkitem != nullptr)
+            {
+                // The caller is about to block on this job while it is still queued, possibly behind other scripts that
+                // were queued earlier. Move it to the front so that the next available background thread picks it up.
+                Processor()->MoveJobToFront(matchedWorkitem);
+
+                if (PHASE_TRACE1(Js::BgParsePhase))
+                {
+                    Js::Tick now = Js::Tick::Now();
+                    Output::Print(
+                        _u("[BgParse: Prioritize -- cookie: %04d on thread 0x%X at %.2f ms]\n"),
+                        matchedWorkitem->GetCookie(),
+                        ::GetCurrentThreadId(),
+                        now.ToMilliseconds()
+                    );
+                }
+            }
         }
 
         // Since this job isn't already processed and the caller needs the results, create an event
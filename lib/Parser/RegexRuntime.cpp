@@ -4922,6 +4922,9 @@ namespace UnifiedRegex
         , literalNextSyncInputOffsets(nullptr)
         , recycler(scriptContext->GetRecycler())
         , previousQcTime(0)
+        , linearProgram(nullptr)
+        , matchCount(0)
+        , isLinearProgramUnsupported(false)
 #if ENABLE_REGEX_CONFIG_OPTIONS
         , stats(0)
         , w(0)
@@ -5172,6 +5175,496 @@ namespace UnifiedRegex
         return WasLastMatchSuccessful();
     }
 
+// Instructions which never push continuations and are left to their own Exec in a linear program
+#define LINEAR_DELEGATED_INSTS(D) \
+    D(SyncToCharAndContinue, SyncToCharAndContinueInst) \
+    D(SyncToChar2SetAndContinue, SyncToChar2SetAndContinueInst) \
+    D(SyncToSetAndContinue, SyncToSetAndContinueInst<false>) \
+    D(SyncToNegatedSetAndContinue, SyncToSetAndContinueInst<true>) \
+    D(SyncToChar2LiteralAndContinue, SyncToChar2LiteralAndContinueInst) \
+    D(SyncToLiteralAndContinue, SyncToLiteralAndContinueInst) \
+    D(SyncToLinearLiteralAndContinue, SyncToLinearLiteralAndContinueInst) \
+    D(SyncToLiteralEquivAndContinue, SyncToLiteralEquivAndContinueInst) \
+    D(SyncToLiteralEquivTrivialLastPatCharAndContinue, SyncToLiteralEquivTrivialLastPatCharAndContinueInst) \
+    D(SyncToCharAndConsume, SyncToCharAndConsumeInst) \
+    D(SyncToChar2SetAndConsume, SyncToChar2SetAndConsumeInst) \
+    D(SyncToSetAndConsume, SyncToSetAndConsumeInst<false>) \
+    D(SyncToNegatedSetAndConsume, SyncToSetAndConsumeInst<true>) \
+    D(SyncToChar2LiteralAndConsume, SyncToChar2LiteralAndConsumeInst) \
+    D(SyncToLiteralAndConsume, SyncToLiteralAndConsumeInst) \
+    D(SyncToLinearLiteralAndConsume, SyncToLinearLiteralAndConsumeInst) \
+    D(SyncToLiteralEquivAndConsume, SyncToLiteralEquivAndConsumeInst) \
+    D(SyncToLiteralEquivTrivialLastPatCharAndConsume, SyncToLiteralEquivTrivialLastPatCharAndConsumeInst) \
+    D(SyncToCharAndBackup, SyncToCharAndBackupInst) \
+    D(SyncToSetAndBackup, SyncToSetAndBackupInst<false>) \
+    D(SyncToNegatedSetAndBackup, SyncToSetAndBackupInst<true>) \
+    D(SyncToChar2LiteralAndBackup, SyncToChar2LiteralAndBackupInst) \
+    D(SyncToLiteralAndBackup, SyncToLiteralAndBackupInst) \
+    D(SyncToLinearLiteralAndBackup, SyncToLinearLiteralAndBackupInst) \
+    D(SyncToLiteralEquivAndBackup, SyncToLiteralEquivAndBackupInst) \
+    D(SyncToLiteralEquivTrivialLastPatCharAndBackup, SyncToLiteralEquivTrivialLastPatCharAndBackupInst) \
+    D(SyncToLiteralsAndBackup, SyncToLiteralsAndBackupInst) \
+    D(MatchLiteralEquiv, MatchLiteralEquivInst) \
+    D(BOLTest, BOLTestInst) \
+    D(EOLTest, EOLTestInst) \
+    D(OptMatchChar, OptMatchCharInst) \
+    D(OptMatchSet, OptMatchSetInst) \
+    D(ChompCharBounded, ChompCharBoundedInst) \
+    D(ChompSetBounded, ChompSetBoundedInst)
+
+    // ----------------------------------------------------------------------
+    // LinearProgram
+    // ----------------------------------------------------------------------
+
+    // Translates the program into steps and classes, or only counts them if steps and classes are null. Returns false if
+    // the program isn't linear.
+    static bool TranslateToLinearSteps(
+        const uint8* instPointer,
+        const uint8* const instsEnd,
+        const char16* const litbuf,
+        LinearStep* const steps,
+        LinearCharClass* const classes,
+        uint &numSteps,
+        uint &numClasses)
+    {
+        Assert((steps == nullptr) == (classes == nullptr));
+
+        LinearStep scratchStep;
+        LinearCharClass scratchClass;
+        LinearStep* charRun = nullptr;
+        numSteps = 0;
+        numClasses = 0;
+
+        auto addStep = [&](LinearStep::StepTag tag) -> LinearStep*
+        {
+            LinearStep* const step = steps == nullptr ? &scratchStep : &steps[numSteps];
+            numSteps++;
+            step->tag = tag;
+            charRun = nullptr;
+            return step;
+        };
+
+        auto addClass = [&](LinearCharClass::ClassTag tag) -> LinearCharClass*
+        {
+            if (charRun == nullptr)
+            {
+                const uint firstClass = numClasses;
+                charRun = addStep(LinearStep::StepTag::MatchChars);
+                charRun->firstClass = firstClass;
+                charRun->length = 0;
+            }
+            charRun->length++;
+
+            LinearCharClass* const charClass = classes == nullptr ? &scratchClass : &classes[numClasses];
+            numClasses++;
+            charClass->tag = tag;
+            return charClass;
+        };
+
+        while (instPointer < instsEnd)
+        {
+            const Inst* const inst = (const Inst*)instPointer;
+            switch (inst->tag)
+            {
+            case Inst::InstTag::Nop:
+                instPointer += sizeof(NopInst);
+                break;
+
+            case Inst::InstTag::Succ:
+                // No jumps, so nothing after this is reachable
+                addStep(LinearStep::StepTag::Succ);
+                return true;
+
+            case Inst::InstTag::MatchChar:
+            {
+                const MatchCharInst* const matchInst = (const MatchCharInst*)inst;
+                addClass(LinearCharClass::ClassTag::Char)->cs[0] = matchInst->c;
+                instPointer += sizeof(*matchInst);
+                break;
+            }
+
+            case Inst::InstTag::MatchChar2:
+            {
+                const MatchChar2Inst* const matchInst = (const MatchChar2Inst*)inst;
+                LinearCharClass* const charClass = addClass(LinearCharClass::ClassTag::Char2);
+                charClass->cs[0] = matchInst->cs[0];
+                charClass->cs[1] = matchInst->cs[1];
+                instPointer += sizeof(*matchInst);
+                break;
+            }
+
+            case Inst::InstTag::MatchChar3:
+            {
+                const MatchChar3Inst* const matchInst = (const MatchChar3Inst*)inst;
+                LinearCharClass* const charClass = addClass(LinearCharClass::ClassTag::Char3);
+                charClass->cs[0] = matchInst->cs[0];
+                charClass->cs[1] = matchInst->cs[1];
+                charClass->cs[2] = matchInst->cs[2];
+                instPointer += sizeof(*matchInst);
+                break;
+            }
+
+            case Inst::InstTag::MatchChar4:
+            {
+                const MatchChar4Inst* const matchInst = (const MatchChar4Inst*)inst;
+                LinearCharClass* const charClass = addClass(LinearCharClass::ClassTag::Char4);
+                charClass->cs[0] = matchInst->cs[0];
+                charClass->cs[1] = matchInst->cs[1];
+                charClass->cs[2] = matchInst->cs[2];
+                charClass->cs[3] = matchInst->cs[3];
+                instPointer += sizeof(*matchInst);
+                break;
+            }
+
+            case Inst::InstTag::MatchSet:
+            {
+                const MatchSetInst<false>* const matchInst = (const MatchSetInst<false>*)inst;
+                addClass(LinearCharClass::ClassTag::Set)->set = &matchInst->set;
+                instPointer += sizeof(*matchInst);
+                break;
+            }
+
+            case Inst::InstTag::MatchNegatedSet:
+            {
+                const MatchSetInst<true>* const matchInst = (const MatchSetInst<true>*)inst;
+                addClass(LinearCharClass::ClassTag::NegatedSet)->set = &matchInst->set;
+                instPointer += sizeof(*matchInst);
+                break;
+            }
+
+            case Inst::InstTag::MatchLiteral:
+            {
+                const MatchLiteralInst* const matchInst = (const MatchLiteralInst*)inst;
+                const char16* const literal = litbuf + matchInst->offset;
+                for (CharCount i = 0; i < matchInst->length; i++)
+                {
+                    addClass(LinearCharClass::ClassTag::Char)->cs[0] = literal[i];
+                }
+                instPointer += sizeof(*matchInst);
+                break;
+            }
+
+            case Inst::InstTag::ChompCharStar:
+                addStep(LinearStep::StepTag::ChompCharStar)->c = ((const ChompCharInst<ChompMode::Star>*)inst)->c;
+                instPointer += sizeof(ChompCharInst<ChompMode::Star>);
+                break;
+
+            case Inst::InstTag::ChompCharPlus:
+                addStep(LinearStep::StepTag::ChompCharPlus)->c = ((const ChompCharInst<ChompMode::Plus>*)inst)->c;
+                instPointer += sizeof(ChompCharInst<ChompMode::Plus>);
+                break;
+
+            case Inst::InstTag::ChompSetStar:
+                addStep(LinearStep::StepTag::ChompSetStar)->set = &((const ChompSetInst<ChompMode::Star>*)inst)->set;
+                instPointer += sizeof(ChompSetInst<ChompMode::Star>);
+                break;
+
+            case Inst::InstTag::ChompSetPlus:
+                addStep(LinearStep::StepTag::ChompSetPlus)->set = &((const ChompSetInst<ChompMode::Plus>*)inst)->set;
+                instPointer += sizeof(ChompSetInst<ChompMode::Plus>);
+                break;
+
+            case Inst::InstTag::BOITest:
+                addStep(LinearStep::StepTag::BOITest);
+                instPointer += sizeof(BOITestInst<false>);
+                break;
+
+            case Inst::InstTag::BOIHardFailTest:
+                addStep(LinearStep::StepTag::BOIHardFailTest);
+                instPointer += sizeof(BOITestInst<true>);
+                break;
+
+            case Inst::InstTag::EOITest:
+                addStep(LinearStep::StepTag::EOITest);
+                instPointer += sizeof(EOITestInst<false>);
+                break;
+
+            case Inst::InstTag::EOIHardFailTest:
+                // Without continuations, hard failing to a later start position is the same as failing
+                addStep(LinearStep::StepTag::EOITest);
+                instPointer += sizeof(EOITestInst<true>);
+                break;
+
+            case Inst::InstTag::WordBoundaryTest:
+                addStep(LinearStep::StepTag::WordBoundaryTest);
+                instPointer += sizeof(WordBoundaryTestInst<false>);
+                break;
+
+            case Inst::InstTag::NegatedWordBoundaryTest:
+                addStep(LinearStep::StepTag::NegatedWordBoundaryTest);
+                instPointer += sizeof(WordBoundaryTestInst<true>);
+                break;
+
+            case Inst::InstTag::BeginDefineGroup:
+                addStep(LinearStep::StepTag::BeginDefineGroup)->groupId = ((const BeginDefineGroupInst*)inst)->groupId;
+                instPointer += sizeof(BeginDefineGroupInst);
+                break;
+
+            case Inst::InstTag::EndDefineGroup:
+                // Nothing to undo the group binding for, so noNeedToSave doesn't matter
+                addStep(LinearStep::StepTag::EndDefineGroup)->groupId = ((const EndDefineGroupInst*)inst)->groupId;
+                instPointer += sizeof(EndDefineGroupInst);
+                break;
+
+            case Inst::InstTag::DefineGroupFixed:
+            {
+                const DefineGroupFixedInst* const defineInst = (const DefineGroupFixedInst*)inst;
+                LinearStep* const step = addStep(LinearStep::StepTag::DefineGroupFixed);
+                step->groupId = defineInst->groupId;
+                step->length = defineInst->length;
+                instPointer += sizeof(*defineInst);
+                break;
+            }
+
+#define DELEGATE(TagName, ClassName) \
+            case Inst::InstTag::TagName: \
+                addStep(LinearStep::StepTag::Delegate)->inst = instPointer; \
+                instPointer += sizeof(ClassName); \
+                break;
+            LINEAR_DELEGATED_INSTS(DELEGATE)
+#undef DELEGATE
+
+            default:
+                // Control flow, loops, assertions and back references
+                return false;
+            }
+        }
+
+        Assert(false); // Programs always end with Succ
+        return false;
+    }
+
+    LinearProgram* LinearProgram::TryNew(Recycler* recycler, const Program* program)
+    {
+        Assert(program->tag == Program::ProgramTag::InstructionsTag
+            || program->tag == Program::ProgramTag::BOIInstructionsTag
+            || program->tag == Program::ProgramTag::BOIInstructionsForStickyFlagTag);
+
+        if (program->numLoops > 0)
+        {
+            return nullptr;
+        }
+
+        const uint8* const insts = program->rep.insts.insts;
+        const uint8* const instsEnd = insts + program->rep.insts.instsLen;
+        const char16* const litbuf = program->rep.insts.litbuf;
+
+        uint numSteps = 0;
+        uint numClasses = 0;
+        if (!TranslateToLinearSteps(insts, instsEnd, litbuf, nullptr, nullptr, numSteps, numClasses))
+        {
+            return nullptr;
+        }
+
+        LinearProgram* const linearProgram = RecyclerNewStructZ(recycler, LinearProgram);
+        linearProgram->steps = RecyclerNewArrayLeaf(recycler, LinearStep, numSteps);
+        linearProgram->classes = numClasses == 0 ? nullptr : RecyclerNewArrayLeaf(recycler, LinearCharClass, numClasses);
+
+        // The classes and sets point into the program's instructions, which live as long as the program
+        const bool translated = TranslateToLinearSteps(insts, instsEnd, litbuf, linearProgram->steps, linearProgram->classes, linearProgram->numSteps, linearProgram->numClasses);
+        Assert(translated);
+        Assert(linearProgram->numSteps == numSteps && linearProgram->numClasses == numClasses);
+        return linearProgram;
+    }
+
+    void Matcher::TryTierUp()
+    {
+        Assert(linearProgram == nullptr && !isLinearProgramUnsupported);
+
+        if (PHASE_OFF1(Js::RegexTierUpPhase))
+        {
+            isLinearProgramUnsupported = true;
+            return;
+        }
+
+        if (matchCount < (uint)CONFIG_FLAG(RegexTierUpThreshold) && !PHASE_FORCE1(Js::RegexTierUpPhase))
+        {
+            matchCount++;
+            return;
+        }
+
+        linearProgram = LinearProgram::TryNew(recycler, program);
+        isLinearProgramUnsupported = linearProgram == nullptr;
+
+        if (PHASE_TRACE1(Js::RegexTierUpPhase))
+        {
+            Output::Print(_u("Regex tier up: /%s/ %s\n"), program->source, linearProgram != nullptr ? _u("linear") : _u("not linear"));
+            Output::Flush();
+        }
+    }
+
+    bool Matcher::ExecDelegatedInst(const uint8* instPointer, const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &inputOffset, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration)
+    {
+        const Inst *const inst = (const Inst*)instPointer;
+        switch (inst->tag)
+        {
+#define DELEGATE(TagName, ClassName) \
+        case Inst::InstTag::TagName: \
+            return ((const ClassName *)inst)->Exec(*this, input, inputLength, matchStart, inputOffset, nextSyncInputOffset, instPointer, contStack, assertionStack, qcTicks, firstIteration);
+        LINEAR_DELEGATED_INSTS(DELEGATE)
+#undef DELEGATE
+        default:
+            Assert(false);
+            __assume(false);
+        }
+    }
+
+    bool Matcher::MatchLinearHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration)
+    {
+        // Delegated instructions fail through the regular path, which expects empty stacks
+        contStack.Clear();
+        assertionStack.Clear();
+
+        ResetInnerGroups(0, program->numGroups - 1);
+
+        const LinearCharClass *const classes = linearProgram->classes;
+        CharCount inputOffset = matchStart;
+        for (const LinearStep *step = linearProgram->steps; ; step++)
+        {
+            Assert(step < linearProgram->steps + linearProgram->numSteps);
+            Assert(inputOffset >= matchStart && inputOffset <= inputLength);
+
+            // Returning false without a match defined for group 0 moves on to the next start position
+            switch (step->tag)
+            {
+            case LinearStep::StepTag::MatchChars:
+            {
+                if (step->length > inputLength - inputOffset)
+                {
+                    return false;
+                }
+
+                const LinearCharClass *const runClasses = classes + step->firstClass;
+                const Char *const inputCurr = input + inputOffset;
+                for (CharCount i = 0; i < step->length; i++)
+                {
+                    if (!runClasses[i].Matches(inputCurr[i]))
+                    {
+                        return false;
+                    }
+                }
+                inputOffset += step->length;
+                break;
+            }
+
+            case LinearStep::StepTag::ChompCharPlus:
+                if (inputOffset >= inputLength || input[inputOffset] != step->c)
+                {
+                    return false;
+                }
+                inputOffset++;
+                // fall through
+
+            case LinearStep::StepTag::ChompCharStar:
+                while (inputOffset < inputLength && input[inputOffset] == step->c)
+                {
+                    inputOffset++;
+                }
+                break;
+
+            case LinearStep::StepTag::ChompSetPlus:
+                if (inputOffset >= inputLength || !step->set->Get(input[inputOffset]))
+                {
+                    return false;
+                }
+                inputOffset++;
+                // fall through
+
+            case LinearStep::StepTag::ChompSetStar:
+                while (inputOffset < inputLength && step->set->Get(input[inputOffset]))
+                {
+                    inputOffset++;
+                }
+                break;
+
+            case LinearStep::StepTag::BOIHardFailTest:
+                if (inputOffset > 0)
+                {
+                    // No use trying any more start positions
+                    matchStart = inputLength;
+                    return false;
+                }
+                break;
+
+            case LinearStep::StepTag::BOITest:
+                if (inputOffset > 0)
+                {
+                    return false;
+                }
+                break;
+
+            case LinearStep::StepTag::EOITest:
+                if (inputOffset < inputLength)
+                {
+                    return false;
+                }
+                break;
+
+            case LinearStep::StepTag::WordBoundaryTest:
+            case LinearStep::StepTag::NegatedWordBoundaryTest:
+            {
+                const bool isNegation = step->tag == LinearStep::StepTag::NegatedWordBoundaryTest;
+                const bool prev = inputOffset > 0 && standardChars->IsWord(input[inputOffset - 1]);
+                const bool curr = inputOffset < inputLength && standardChars->IsWord(input[inputOffset]);
+                if (isNegation == (prev != curr))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            case LinearStep::StepTag::BeginDefineGroup:
+            {
+                GroupInfo *const groupInfo = GroupIdToGroupInfo(step->groupId);
+                Assert(groupInfo->IsUndefined());
+                groupInfo->offset = inputOffset;
+                break;
+            }
+
+            case LinearStep::StepTag::EndDefineGroup:
+            {
+                GroupInfo *const groupInfo = GroupIdToGroupInfo(step->groupId);
+                Assert(groupInfo->IsUndefined());
+                Assert(inputOffset >= groupInfo->offset);
+                groupInfo->length = inputOffset - groupInfo->offset;
+                break;
+            }
+
+            case LinearStep::StepTag::DefineGroupFixed:
+            {
+                GroupInfo *const groupInfo = GroupIdToGroupInfo(step->groupId);
+                Assert(groupInfo->IsUndefined());
+                groupInfo->offset = inputOffset - step->length;
+                groupInfo->length = step->length;
+                break;
+            }
+
+            case LinearStep::StepTag::Delegate:
+                if (ExecDelegatedInst(step->inst, input, inputLength, matchStart, inputOffset, nextSyncInputOffset, contStack, assertionStack, qcTicks, firstIteration))
+                {
+                    // The instruction failed, and may have given up on later start positions too
+                    Assert(!WasLastMatchSuccessful());
+                    return false;
+                }
+                break;
+
+            case LinearStep::StepTag::Succ:
+            {
+                GroupInfo *const info = GroupIdToGroupInfo(0);
+                info->offset = matchStart;
+                info->length = inputOffset - matchStart;
+                return true;
+            }
+
+            default:
+                Assert(false);
+                __assume(false);
+            }
+        }
+    }
+
+#undef LINEAR_DELEGATED_INSTS
+
     inline bool Matcher::MatchSingleCharCaseInsensitive(const Char* const input, const CharCount inputLength, CharCount offset, const Char c)
     {
         CaseInsensitive::MappingSource mappingSource = program->GetCaseMappingSource();
@@ -5504,6 +5997,18 @@ namespace UnifiedRegex
 
                 RegexStacks * regexStacks = scriptContext->RegexStacks();
 
+                if (linearProgram == nullptr && !isLinearProgramUnsupported)
+                {
+                    TryTierUp();
+                }
+
+                // Stay in the interpreter while tracing or collecting stats
+                const bool useLinearProgram = linearProgram != nullptr
+#if ENABLE_REGEX_CONFIG_OPTIONS
+                    && w == nullptr && stats == nullptr
+#endif
+                    ;
+
                 // Need to continue matching even if matchStart == inputLim since some patterns may match an empty string at the end
                 // of the input. For instance: /a*$/.exec("b")
                 bool firstIteration = true;
@@ -5511,7 +6016,9 @@ namespace UnifiedRegex
                 {
                     // Let there be only one call to MatchHere(), as that call expands the interpreter loop in-place. Having
                     // multiple calls to MatchHere() would bloat the code.
-                    res = MatchHere(input, inputLength, offset, nextSyncInputOffset, regexStacks->contStack, regexStacks->assertionStack, qcTicks, firstIteration);
+                    res = useLinearProgram
+                        ? MatchLinearHere(input, inputLength, offset, nextSyncInputOffset, regexStacks->contStack, regexStacks->assertionStack, qcTicks, firstIteration)
+                        : MatchHere(input, inputLength, offset, nextSyncInputOffset, regexStacks->contStack, regexStacks->assertionStack, qcTicks, firstIteration);
                     firstIteration = false;
                 } while(!res && loopMatchHere && ++offset <= inputLength);
 
@@ -36,6 +36,7 @@ namespace UnifiedRegex
         friend struct AltNode;
         friend class Matcher;
         friend struct LoopInfo;
+        friend struct LinearProgram;
 
         template <typename ScannerT>
         friend struct SyncToLiteralAndConsumeInstT;
@@ -1715,6 +1716,96 @@ namespace UnifiedRegex
         CONT_BODY
     };
 
+    // ----------------------------------------------------------------------
+    // Linear programs
+    // ----------------------------------------------------------------------
+
+    // Once a pattern has been matched often enough, a program that can never backtrack (no alternatives, loops or
+    // assertions, only character matches, chomps, anchors, group definitions and syncs) is translated into a flat array
+    // of steps. Running the steps needs no continuation stack, and runs of single character matches are fused into one
+    // step which checks the remaining input length once. Syncs and other instructions which can't push continuations
+    // are delegated to the instruction itself.
+
+    struct LinearCharClass : private Chars<char16>
+    {
+        enum class ClassTag : uint8
+        {
+            Char,
+            Char2,
+            Char3,
+            Char4,
+            Set,
+            NegatedSet
+        };
+
+        ClassTag tag;
+        Char cs[4];
+        const RuntimeCharSet<Char>* set;
+
+        inline bool Matches(const Char c) const
+        {
+            switch (tag)
+            {
+            case ClassTag::Char:
+                return c == cs[0];
+            case ClassTag::Char2:
+                return c == cs[0] || c == cs[1];
+            case ClassTag::Char3:
+                return c == cs[0] || c == cs[1] || c == cs[2];
+            case ClassTag::Char4:
+                return c == cs[0] || c == cs[1] || c == cs[2] || c == cs[3];
+            case ClassTag::Set:
+                return set->Get(c);
+            case ClassTag::NegatedSet:
+                return !set->Get(c);
+            default:
+                Assume(false);
+                return false;
+            }
+        }
+    };
+
+    struct LinearStep : private Chars<char16>
+    {
+        enum class StepTag : uint8
+        {
+            MatchChars,             // match 'length' classes starting at 'firstClass'
+            ChompCharStar,
+            ChompCharPlus,
+            ChompSetStar,
+            ChompSetPlus,
+            BOITest,
+            BOIHardFailTest,
+            EOITest,
+            WordBoundaryTest,
+            NegatedWordBoundaryTest,
+            BeginDefineGroup,
+            EndDefineGroup,
+            DefineGroupFixed,
+            Delegate,               // execute 'inst' as the interpreter would
+            Succ
+        };
+
+        StepTag tag;
+        Char c;
+        int groupId;
+        CharCount length;
+        uint firstClass;
+        const RuntimeCharSet<Char>* set;
+        const uint8* inst;
+    };
+
+    struct LinearProgram
+    {
+        Field(LinearStep*) steps;
+        Field(LinearCharClass*) classes;
+        Field(uint) numSteps;
+        Field(uint) numClasses;
+
+        // Returns nullptr if the program may backtrack or uses an instruction that isn't supported
+        static LinearProgram* TryNew(Recycler* recycler, const Program* program);
+    };
+
     // ----------------------------------------------------------------------
     // Matcher
     // ----------------------------------------------------------------------
@@ -1822,6 +1913,11 @@ namespace UnifiedRegex
 
         Field(uint) previousQcTime;
 
+        // Tiering to a linear program, see LinearProgram
+        Field(LinearProgram*) linearProgram;
+        Field(uint) matchCount;
+        Field(bool) isLinearProgramUnsupported;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         FieldNoBarrier(RegexStats*) stats;
         FieldNoBarrier(DebugWriter*) w;
@@ -1887,6 +1983,10 @@ namespace UnifiedRegex
         inline void Run(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
         inline bool MatchHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
 
+        void TryTierUp();
+        bool MatchLinearHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
+        bool ExecDelegatedInst(const uint8* instPointer, const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &inputOffset, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
+
         // Return true if assertion succeeded
         inline bool PopAssertion(CharCount &inputOffset, const uint8 *&instPointer, ContStack &contStack, AssertionStack &assertionStack, bool isFailed);
 
@@ -4,6 +4,12 @@
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
 
+#if defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
 /*****************************************************************************
 *
 *  The following table speeds various tests of characters, such as whether
@@ -33,6 +39,137 @@ int CountNewlines(LPCOLESTR psz)
     return cln;
 }
 
+/*****************************************************************************
+*
+*  Skipping runs of plain ASCII characters. Identifiers, whitespace, comment
+*  bodies and string literal contents are mostly made of characters that need
+*  no special handling, so these are classified 16 bytes at a time on x64
+*  instead of going one character at a time through the scanner's switches.
+*/
+
+#if defined(_M_X64)
+static inline uint FirstStopIndex(uint stopMask)
+{
+    Assert(stopMask != 0);
+    DWORD index;
+    _BitScanForward(&index, stopMask);
+    return index;
+}
+#endif
+
+static inline bool IsAsciiIdentifierChar(utf8char_t ch)
+{
+    return (uint)((ch | 0x20) - 'a') <= 'z' - 'a' || (uint)(ch - '0') <= 9 || ch == '_' || ch == '$';
+}
+
+LPCUTF8 SkipAsciiIdentifierChars(LPCUTF8 p, LPCUTF8 last)
+{
+#if defined(_M_X64)
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    while (last - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+
+        // Setting the case bit maps 'A'-'Z' onto 'a'-'z'. Non-ASCII bytes compare as negative and never match.
+        __m128i folded = _mm_or_si128(chars, caseBit);
+        __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1)));
+        __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+        __m128i isOther = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('_')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('$')));
+
+        uint stopMask = ~(uint)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(isLetter, isDigit), isOther)) & 0xFFFF;
+        if (stopMask != 0)
+        {
+            return p + FirstStopIndex(stopMask);
+        }
+        p += 16;
+    }
+#endif
+
+    while (p < last && IsAsciiIdentifierChar(*p))
+    {
+        p++;
+    }
+    return p;
+}
+
+LPCUTF8 SkipAsciiWhitespace(LPCUTF8 p, LPCUTF8 last)
+{
+#if defined(_M_X64)
+    while (last - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i isSpace = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('\t')));
+
+        uint stopMask = ~(uint)_mm_movemask_epi8(isSpace) & 0xFFFF;
+        if (stopMask != 0)
+        {
+            return p + FirstStopIndex(stopMask);
+        }
+        p += 16;
+    }
+#endif
+
+    while (p < last && (*p == ' ' || *p == '\t'))
+    {
+        p++;
+    }
+    return p;
+}
+
+// Skips characters until NUL, a non-ASCII byte or one of the stop characters. Unused stop character slots repeat one
+// of the others.
+template <utf8char_t s0, utf8char_t s1, utf8char_t s2, utf8char_t s3, utf8char_t s4, utf8char_t s5, utf8char_t s6>
+static LPCUTF8 SkipUntilStopChar(LPCUTF8 p, LPCUTF8 last)
+{
+#if defined(_M_X64)
+    while (last - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i isStop = _mm_or_si128(
+            _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_setzero_si128()), _mm_cmpeq_epi8(chars, _mm_set1_epi8((char)s0))),
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8((char)s1)), _mm_cmpeq_epi8(chars, _mm_set1_epi8((char)s2)))),
+            _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8((char)s3)), _mm_cmpeq_epi8(chars, _mm_set1_epi8((char)s4))),
+                _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8((char)s5)), _mm_cmpeq_epi8(chars, _mm_set1_epi8((char)s6)))));
+
+        // The sign bit of non-ASCII bytes is set, so they always end the run
+        uint stopMask = (uint)_mm_movemask_epi8(_mm_or_si128(isStop, chars));
+        if (stopMask != 0)
+        {
+            return p + FirstStopIndex(stopMask);
+        }
+        p += 16;
+    }
+#endif
+
+    for (; p < last; p++)
+    {
+        utf8char_t ch = *p;
+        if (ch == 0 || ch >= 0x80 || ch == s0 || ch == s1 || ch == s2 || ch == s3 || ch == s4 || ch == s5 || ch == s6)
+        {
+            break;
+        }
+    }
+    return p;
+}
+
+LPCUTF8 SkipLineCommentChars(LPCUTF8 p, LPCUTF8 last)
+{
+    return SkipUntilStopChar<'\r', '\n', '\n', '\n', '\n', '\n', '\n'>(p, last);
+}
+
+LPCUTF8 SkipBlockCommentChars(LPCUTF8 p, LPCUTF8 last)
+{
+    return SkipUntilStopChar<'*', '\r', '\n', '\n', '\n', '\n', '\n'>(p, last);
+}
+
+LPCUTF8 SkipStringLiteralChars(LPCUTF8 p, LPCUTF8 last)
+{
+    // '`' and '$' only matter to string templates, and are left to the regular path for simplicity
+    return SkipUntilStopChar<'"', '\'', '`', '$', '\\', '\r', '\n'>(p, last);
+}
+
 BOOL Token::IsKeyword() const
 {
     // keywords (but not future reserved words)
@@ -425,6 +562,7 @@ BOOL Scanner<EncodingPolicy>::FastIdentifierContinue(EncodedCharPtr&p, EncodedCh
 {
     if (EncodingPolicy::MultiUnitEncoding)
     {
+        p = this->SkipIdentifierRun(p, last);
         while (p < last)
         {
             EncodedChar currentChar = *p;
@@ -1034,6 +1172,15 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
 
     for (;;)
     {
+        // Copy runs of characters that need no special handling in bulk
+        EncodedCharPtr pchRun = p;
+        p = this->SkipStringRun(p, last);
+        if (p != pchRun)
+        {
+            m_tempChBuf.template AppendRun<true>(pchRun, p);
+            m_tempChBufSecondary.template AppendRun<createRawString>(pchRun, p);
+        }
+
         switch ((rawch = ch = this->ReadFirst(p, last)))
         {
         case kchRET:
@@ -1448,6 +1595,8 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+        p = this->SkipBlockCommentRun(p, last);
+
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -1696,6 +1845,7 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
         case 0x000C:
         case 0x0020:
             Assert(chType == _C_WSP);
+            p = this->SkipWhitespaceRun(p, last);
             continue;
 
         case '.':
@@ -1962,6 +2112,8 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
                 pchT = NULL;
                 for (;;)
                 {
+                    p = this->SkipLineCommentRun(p, last);
+
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
@@ -144,6 +144,15 @@ struct Token
 typedef BYTE UTF8Char;
 typedef UTF8Char* UTF8CharPtr;
 
+// Skip over runs of plain ASCII characters without going through the scanner's per-character dispatch. Each returns the
+// first position in [p, last) that has to be handled by the character-at-a-time code (a character outside the run, NUL
+// or the lead byte of a multi-unit character), or last.
+LPCUTF8 SkipAsciiIdentifierChars(LPCUTF8 p, LPCUTF8 last);
+LPCUTF8 SkipAsciiWhitespace(LPCUTF8 p, LPCUTF8 last);
+LPCUTF8 SkipLineCommentChars(LPCUTF8 p, LPCUTF8 last);
+LPCUTF8 SkipBlockCommentChars(LPCUTF8 p, LPCUTF8 last);
+LPCUTF8 SkipStringLiteralChars(LPCUTF8 p, LPCUTF8 last);
+
 class NullTerminatedUnicodeEncodingPolicy
 {
 public:
@@ -170,6 +179,13 @@ class NullTerminatedUnicodeEncodingPolicy
         return 0xfffe;
     }
 
+    // The UTF16 scanner is only used for syntax coloring, so it has no fast paths for runs of ASCII characters
+    static EncodedCharPtr SkipIdentifierRun(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipWhitespaceRun(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipLineCommentRun(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipBlockCommentRun(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+    static EncodedCharPtr SkipStringRun(EncodedCharPtr p, EncodedCharPtr last) { return p; }
+
     static void RestoreMultiUnits(size_t multiUnits) { }
     static size_t CharacterOffsetToUnitOffset(EncodedCharPtr start, EncodedCharPtr current, EncodedCharPtr last, charcount_t offset) { return offset; }
 
@@ -224,6 +240,12 @@ class UTF8EncodingPolicyBase
 
     static OLECHAR PeekFirst(EncodedCharPtr p, EncodedCharPtr last) { return (nullTerminated || p < last) ? static_cast<OLECHAR>(*p) : 0; }
 
+    static EncodedCharPtr SkipIdentifierRun(EncodedCharPtr p, EncodedCharPtr last) { return SkipAsciiIdentifierChars(p, last); }
+    static EncodedCharPtr SkipWhitespaceRun(EncodedCharPtr p, EncodedCharPtr last) { return SkipAsciiWhitespace(p, last); }
+    static EncodedCharPtr SkipLineCommentRun(EncodedCharPtr p, EncodedCharPtr last) { return SkipLineCommentChars(p, last); }
+    static EncodedCharPtr SkipBlockCommentRun(EncodedCharPtr p, EncodedCharPtr last) { return SkipBlockCommentChars(p, last); }
+    static EncodedCharPtr SkipStringRun(EncodedCharPtr p, EncodedCharPtr last) { return SkipStringLiteralChars(p, last); }
+
     OLECHAR PeekFull(EncodedCharPtr p, EncodedCharPtr last)
     {
         OLECHAR result = PeekFirst(p, last);
@@ -659,6 +681,26 @@ class Scanner : public IScanner, public EncodingPolicy
             }
         }
 
+        template<bool performAppend, typename TChar> void AppendRun(const TChar *pch, const TChar *pchLim)
+        {
+            if (performAppend)
+            {
+                Assert(pch <= pchLim);
+                uint32 cch = (uint32)(pchLim - pch);
+                while (cch > m_cchMax - m_ichCur)
+                {
+                    Grow();
+                }
+
+                OLECHAR *pchDst = m_prgch + m_ichCur;
+                for (uint32 i = 0; i < cch; i++)
+                {
+                    pchDst[i] = static_cast<OLECHAR>(pch[i]);
+                }
+                m_ichCur += cch;
+            }
+        }
+
     private:
         void Grow()
         {
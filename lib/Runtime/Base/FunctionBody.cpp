@@ -3455,6 +3455,10 @@ namespace Js
                 }
             }
 #endif
+            if (this->dynamicProfileInfo && this->dynamicProfileInfo->WasFullJitted())
+            {
+                this->SetWasFullJittedInLoadedProfile();
+            }
         }
 
 #ifdef DYNAMIC_PROFILE_MUTATOR
@@ -7645,6 +7649,36 @@ namespace Js
         TraceExecutionMode("HasHotLoop");
     }
 
+#if ENABLE_PROFILE_INFO
+    void FunctionBody::SetWasFullJittedInLoadedProfile()
+    {
+        // The loaded profile comes from a run in which this function was hot enough to be full JIT'ed. The profile already
+        // carries the type feedback full JIT needs, so skip simple JIT and get to full JIT as soon as possible.
+        if(Configuration::Global.flags.EnforceExecutionModeLimits ||
+            PHASE_OFF(Phase::ProfileBasedFullJitPhase, this) ||
+            PHASE_OFF(Phase::FullJitPhase, this) ||
+            this->GetIsAsmjsMode() ||
+            this->GetExecutionMode() == ExecutionMode::FullJit)
+        {
+            return;
+        }
+
+        executionState.CommitExecutedIterations();
+        TraceExecutionMode("WasFullJittedInLoadedProfile (before)");
+        if(executionState.GetFullJitThreshold() > 1)
+        {
+            executionState.SetFullJitThreshold(1, true);
+        }
+        TraceExecutionMode("WasFullJittedInLoadedProfile");
+
+        if(PHASE_TRACE(Phase::ProfileBasedFullJitPhase, this))
+        {
+            Output::Print(_u("ProfileBasedFullJit: %s goes to full JIT on its first call\n"), this->GetDisplayName());
+            Output::Flush();
+        }
+    }
+#endif
+
     bool FunctionBody::IsInlineApplyDisabled()
     {
         return this->disableInlineApply;
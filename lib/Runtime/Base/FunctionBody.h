@@ -2684,6 +2684,9 @@ namespace Js
 
         bool GetHasHotLoop() const { return hasHotLoop; };
         void SetHasHotLoop();
+#if ENABLE_PROFILE_INFO
+        void SetWasFullJittedInLoadedProfile();
+#endif
 
         bool GetHasNestedLoop() const { return hasNestedLoop; };
         void SetHasNestedLoop(bool nest) { hasNestedLoop = nest; };
@@ -230,6 +230,8 @@ namespace Js
 
 #ifdef BGJIT_STATS
         interpretedCount = maxFuncInterpret = funcJITCount = bytecodeJITCount = interpretedCallsHighPri = jitCodeUsed = funcJitCodeUsed = loopJITCount = speculativeJitCount = 0;
+        jitQueueWaitCount = 0;
+        jitQueueWaitMicroseconds = maxJitQueueWaitMicroseconds = 0;
 #endif
 
 #ifdef PROFILE_TYPES
@@ -3040,7 +3042,16 @@ namespace Js
 #if ENABLE_PROFILE_INFO
         if (!this->startupComplete)
         {
-            sourceContextInfo->sourceDynamicProfileManager = SourceDynamicProfileManager::LoadFromDynamicProfileStorage(sourceContextInfo, this, dataCacheWrapper);
+            SourceDynamicProfileManager * hostProvidedProfile = nullptr;
+            if (this->Cache()->hostProvidedProfileMap != nullptr
+                && this->Cache()->hostProvidedProfileMap->TryGetValueAndRemove(sourceContext, &hostProvidedProfile))
+            {
+                sourceContextInfo->sourceDynamicProfileManager = hostProvidedProfile;
+            }
+            else
+            {
+                sourceContextInfo->sourceDynamicProfileManager = SourceDynamicProfileManager::LoadFromDynamicProfileStorage(sourceContextInfo, this, dataCacheWrapper);
+            }
             Assert(sourceContextInfo->sourceDynamicProfileManager != NULL);
         }
 
@@ -3049,6 +3060,31 @@ namespace Js
         return sourceContextInfo;
     }
 
+#if ENABLE_PROFILE_INFO
+    //
+    // Registers a profile, loaded from a buffer provided by the host, to be used when the source with the given
+    // context is loaded. Returns false if the source has already been loaded.
+    //
+    bool ScriptContext::SetHostProvidedProfile(DWORD_PTR hostSourceContext, SourceDynamicProfileManager * profileManager)
+    {
+        Assert(hostSourceContext != Js::Constants::NoHostSourceContext);
+        Assert(profileManager != nullptr);
+
+        EnsureSourceContextInfoMap();
+        if (this->startupComplete || this->Cache()->sourceContextInfoMap->ContainsKey(hostSourceContext))
+        {
+            return false;
+        }
+
+        if (this->Cache()->hostProvidedProfileMap == nullptr)
+        {
+            this->Cache()->hostProvidedProfileMap = RecyclerNew(this->GetRecycler(), HostProvidedProfileMap, this->GetRecycler());
+        }
+        this->Cache()->hostProvidedProfileMap->Item(hostSourceContext, profileManager);
+        return true;
+    }
+#endif
+
     // static
     const char16* ScriptContext::CopyString(const char16* str, size_t charCount, ArenaAllocator* alloc)
     {
@@ -6049,6 +6085,9 @@ ScriptContext::GetJitFuncRangeCache()
             Output::Print(_u("** TotalInterpretedCalls: %6d MaxFuncInterp: %6d  InterpretedHighPri: %6d \n"),
                 interpretedCount, maxFuncInterpret, interpretedCallsHighPri);
             Output::Print(_u("** ZeroInterpretedFunctions: %6d OneInterpretedFunctions: %6d ZeroInterpretedWithNonZeroBytecode: %6d \n "), zeroInterpretedFunctions, oneInterpretedFunctions, nonZeroBytecodeFunctions);
+            Output::Print(_u("** JitQueueWaits: %6d TotalWait: %10.3f mSec AverageWait: %8.3f mSec MaxWait: %8.3f mSec\n"),
+                jitQueueWaitCount, jitQueueWaitMicroseconds / 1000.0,
+                jitQueueWaitCount ? jitQueueWaitMicroseconds / 1000.0 / jitQueueWaitCount : 0.0, maxJitQueueWaitMicroseconds / 1000.0);
             Output::Print(_u("** %-24s : %-10s %-10s %-10s %-10s %-10s\n"), _u("InterpretedCounts"), _u("Total"), _u("NativeCode"), _u("Used"), _u("Usage"), _u("Rejits"));
             uint low = 0;
             uint high = 0;
@@ -702,6 +702,9 @@ namespace Js
         uint jitCodeUsed;
         uint funcJitCodeUsed;
         uint speculativeJitCount;
+        uint jitQueueWaitCount;
+        int64 jitQueueWaitMicroseconds;
+        int64 maxJitQueueWaitMicroseconds;
 #endif
 #if DBG
         // Count how many Out of Memory and Stack overflow exceptions happened during the execution
@@ -1104,6 +1107,9 @@ namespace Js
         SourceContextInfo * CreateSourceContextInfo(uint hash, DWORD_PTR hostSourceContext);
         SourceContextInfo * CreateSourceContextInfo(DWORD_PTR hostSourceContext, char16 const * url, size_t len,
             SimpleDataCacheWrapper* dataCacheWrapper, char16 const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0);
+#if ENABLE_PROFILE_INFO
+        bool SetHostProvidedProfile(DWORD_PTR hostSourceContext, SourceDynamicProfileManager * profileManager);
+#endif
 
 #if defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
         void ClearSourceContextInfoMaps()
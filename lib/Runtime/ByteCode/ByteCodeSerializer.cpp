@@ -4736,12 +4736,12 @@ class ByteCodeBufferReader
 // This constructor is for allocating a ByteCodeCache without a reader (ie: before the bytecode buffer is generated).
 // SetReader() should be called before using the cache.
 ByteCodeCache::ByteCodeCache(ScriptContext * scriptContext, int builtInPropertyCount)
-    : reader(nullptr), propertyCount(0), builtInPropertyCount(builtInPropertyCount), raw(nullptr), propertyIds(nullptr), localFunctionIdToFunctionInfoMap(nullptr), localScopeInfoIdToScopeInfoMap(nullptr), scopeInfoCount(0), scopeInfoRelativeOffsets(nullptr)
+    : reader(nullptr), scriptContext(scriptContext), propertyCount(0), populatedPropertyCount(0), builtInPropertyCount(builtInPropertyCount), raw(nullptr), propertyIds(nullptr), localFunctionIdToFunctionInfoMap(nullptr), localScopeInfoIdToScopeInfoMap(nullptr), scopeInfoCount(0), scopeInfoRelativeOffsets(nullptr)
 {
 }
 
 ByteCodeCache::ByteCodeCache(ScriptContext * scriptContext, ByteCodeBufferReader * reader, int builtInPropertyCount)
-    : reader(reader), propertyCount(0), builtInPropertyCount(builtInPropertyCount), localFunctionIdToFunctionInfoMap(nullptr), localScopeInfoIdToScopeInfoMap(nullptr), scopeInfoCount(0), scopeInfoRelativeOffsets(nullptr)
+    : reader(reader), scriptContext(scriptContext), propertyCount(0), populatedPropertyCount(0), builtInPropertyCount(builtInPropertyCount), localFunctionIdToFunctionInfoMap(nullptr), localScopeInfoIdToScopeInfoMap(nullptr), scopeInfoCount(0), scopeInfoRelativeOffsets(nullptr)
 {
     Initialize(scriptContext);
 }
@@ -4767,11 +4767,7 @@ void ByteCodeCache::Initialize(ScriptContext * scriptContext)
 
     raw = reader->raw;
 
-    // Read and populate PropertyIds
-    for (int i = 0; i < propertyCount; ++i)
-    {
-        PopulateLookupPropertyId(scriptContext, i);
-    }
+    // PropertyIds are populated on first lookup, see GetPropertyIdAt
 
     scopeInfoCount = reader->scopeInfoCount;
     if (scopeInfoCount > 0)
@@ -4803,6 +4799,7 @@ void ByteCodeCache::PopulateLookupPropertyId(ScriptContext * scriptContext, int
             JsUtil::CharacterBuffer<char16>(propertyName, propertyNameLength));
 
         propertyIds[realOffset] = propertyRecord->GetPropertyId();
+        populatedPropertyCount++;
     }
 }
 
@@ -4965,6 +4962,14 @@ HRESULT ByteCodeSerializer::DeserializeFromBufferInternal(ScriptContext * script
 
     hr = reader->ReadTopFunctionBody(function, sourceInfo, cache, ((scriptFlags & fscrAllowFunctionProxy) == fscrAllowFunctionProxy), nativeModule);
 
+    if (SUCCEEDED(hr) && PHASE_STATS1(Js::ByteCodeSerializationPhase))
+    {
+        // Byte code and strings are used in place; only what the top level function needed has been materialized so far
+        Output::Print(_u("ByteCodeSerialization: %d bytes used in place, %d functions, %d of %d property records created\n"),
+            reader->totalSize, reader->functionCount, cache->GetPopulatedPropertyCount(), cache->GetPropertyCount());
+        Output::Flush();
+    }
+
     //ETW Event stop
     JS_ETW(EventWriteJSCRIPT_BYTECODEDESERIALIZE_STOP(scriptContext,0));
 
@@ -5007,6 +5012,9 @@ FunctionBody* ByteCodeSerializer::DeserializeFunction(ScriptContext* scriptConte
         Js::Throw::InternalError();
     }
 
+    OUTPUT_TRACE(Js::ByteCodeSerializationPhase, _u("Deserialized deferred function %s. Property records created: %d of %d\n"),
+        deserializedFunctionBody->GetDisplayName(), cache->GetPopulatedPropertyCount(), cache->GetPropertyCount());
+
     return deserializedFunctionBody;
 }
 
@@ -109,9 +109,11 @@ namespace Js
     class ByteCodeCache
     {
         ByteCodeBufferReader * reader;
+        ScriptContext * scriptContext;
         const byte * raw;
         PropertyId * propertyIds;
         int propertyCount;
+        int populatedPropertyCount;
         int builtInPropertyCount;
         uint scopeInfoCount;
         const byte** scopeInfoRelativeOffsets;
@@ -125,6 +127,19 @@ namespace Js
         LocalFunctionIdToFunctionInfoMap * EnsureLocalFunctionIdToFunctionInfoMap(ScriptContext * scriptContext);
         LocalScopeInfoIdToScopeInfoMap * EnsureLocalScopeInfoIdToScopeInfoMap(ScriptContext * scriptContext);
 
+        // Property records are only created when a function that references them is deserialized, so that
+        // the string table of a large buffer is not walked (and paged in) up front.
+        inline PropertyId GetPropertyIdAt(int realOffset)
+        {
+            Assert(realOffset<propertyCount);
+            if (propertyIds[realOffset] == -1)
+            {
+                PopulateLookupPropertyId(scriptContext, realOffset);
+            }
+            Assert(propertyIds[realOffset]!=-1);
+            return propertyIds[realOffset];
+        }
+
     public:
         ByteCodeCache(ScriptContext * scriptContext, int builtInPropertyCount);
         ByteCodeCache(ScriptContext * scriptContext, ByteCodeBufferReader * reader, int builtInPropertyCount);
@@ -142,28 +157,25 @@ namespace Js
         }
 
         // Convert a serialized propertyID into a real one.
-        inline PropertyId LookupPropertyId(PropertyId obscuredIdInCache) const
+        inline PropertyId LookupPropertyId(PropertyId obscuredIdInCache)
         {
             auto unobscured = obscuredIdInCache ^ SERIALIZER_OBSCURE_PROPERTY_ID;
             if (unobscured < builtInPropertyCount || unobscured==/*nil*/0xffffffff)
             {
                 return unobscured; // This is a built in property id
             }
-            auto realOffset = unobscured - builtInPropertyCount;
-            Assert(realOffset<propertyCount);
-            Assert(propertyIds[realOffset]!=-1);
-            return propertyIds[realOffset];
+            return GetPropertyIdAt(unobscured - builtInPropertyCount);
         }
 
         // Convert a serialized propertyID into a real one.
-        inline PropertyId LookupNonBuiltinPropertyId(PropertyId obscuredIdInCache) const
+        inline PropertyId LookupNonBuiltinPropertyId(PropertyId obscuredIdInCache)
         {
-            auto realOffset = obscuredIdInCache ^ SERIALIZER_OBSCURE_NONBUILTIN_PROPERTY_ID;
-            Assert(realOffset<propertyCount);
-            Assert(propertyIds[realOffset]!=-1);
-            return propertyIds[realOffset];
+            return GetPropertyIdAt(obscuredIdInCache ^ SERIALIZER_OBSCURE_NONBUILTIN_PROPERTY_ID);
         }
 
+        int GetPropertyCount() const { return propertyCount; }
+        int GetPopulatedPropertyCount() const { return populatedPropertyCount; }
+
         // Get the raw byte code buffer.
         inline const byte * GetBuffer() const
         {
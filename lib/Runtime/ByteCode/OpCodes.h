@@ -500,6 +500,9 @@ MACRO_BACKEND_ONLY(     StAtomicWasm,           ElementI,       OpSideEffect
 MACRO_BACKEND_ONLY(     LdAtomicWasm,           ElementI,       OpSideEffect        )       // Atomic load from typed array view
 MACRO_BACKEND_ONLY(     Memset,                 ElementI,       OpSideEffect)
 MACRO_BACKEND_ONLY(     Memcopy,                ElementI,       OpSideEffect)
+MACRO_BACKEND_ONLY(     Memadd,                 ElementI,       OpSideEffect)   // dst[i] = src1[i] + src2, for i in a range; see GlobOpt::EmitMemop
+MACRO_BACKEND_ONLY(     Memsub,                 ElementI,       OpSideEffect)
+MACRO_BACKEND_ONLY(     Memmul,                 ElementI,       OpSideEffect)
 MACRO_BACKEND_ONLY(     ArrayDetachedCheck,     Reg1,           None)   // ensures that an ArrayBuffer has not been detached
 MACRO_BACKEND_ONLY(     LdNativeCodeData,       Reg1,           OpSideEffect)   // load native code data buffer
 MACRO_WMS(              StArrItemI_CI4,         ElementUnsigned1,      OpSideEffect)
@@ -589,7 +589,7 @@ namespace TTD
         m_eventListVTable(nullptr), m_eventList(&this->m_eventSlabAllocator), m_currentReplayEventIterator(),
         m_modeStack(), m_currentMode(TTDMode::Invalid), m_autoTracesEnabled(true),
         m_snapExtractor(), m_elapsedExecutionTimeSinceSnapshot(0.0),
-        m_lastInflateSnapshotTime(-1), m_lastInflateMap(nullptr), m_propertyRecordList(&this->m_miscSlabAllocator),
+        m_lastInflateSnapshotTime(-1), m_lastInflateMap(nullptr), m_startupSnapshot(nullptr), m_startupSnapshotTime(-1), m_propertyRecordList(&this->m_miscSlabAllocator),
         m_sourceInfoCount(0), m_loadedTopLevelScripts(&this->m_miscSlabAllocator), m_newFunctionTopLevelScripts(&this->m_miscSlabAllocator), m_evalTopLevelScripts(&this->m_miscSlabAllocator)
     {
         this->InitializeEventListVTable();
@@ -611,6 +611,12 @@ namespace TTD
             this->m_lastInflateMap = nullptr;
         }
 
+        if(this->m_startupSnapshot != nullptr)
+        {
+            TT_HEAP_DELETE(SnapShot, this->m_startupSnapshot);
+            this->m_startupSnapshot = nullptr;
+        }
+
         if(this->m_propertyRecordPinSet != nullptr)
         {
             this->m_propertyRecordPinSet.Unroot(this->m_propertyRecordPinSet->GetAllocator());
@@ -1484,43 +1490,8 @@ namespace TTD
         return -1;
     }
 
-    void EventLog::DoSnapshotInflate(int64 etime)
+    bool EventLog::DoSnapshotInflate_Helper(const SnapShot* snap, int64 etime, bool canCreateContexts)
     {
-        this->PushMode(TTDMode::ExcludedExecutionTTAction);
-
-        const SnapShot* snap = nullptr;
-        int64 restoreEventTime = -1;
-
-        for(auto iter = this->m_eventList.GetIteratorAtLast_ReplayOnly(); iter.IsValid(); iter.MovePrevious_ReplayOnly())
-        {
-            NSLogEvents::EventLogEntry* evt = iter.Current();
-            if(evt->EventKind == NSLogEvents::EventKind::SnapshotTag)
-            {
-                NSLogEvents::SnapshotEventLogEntry* snapEvent = NSLogEvents::GetInlineEventDataAs<NSLogEvents::SnapshotEventLogEntry, NSLogEvents::EventKind::SnapshotTag>(evt);
-                if(snapEvent->RestoreTimestamp == etime)
-                {
-                    NSLogEvents::SnapshotEventLogEntry_EnsureSnapshotDeserialized(evt, this->m_threadContext);
-
-                    restoreEventTime = snapEvent->RestoreTimestamp;
-                    snap = snapEvent->Snap;
-                    break;
-                }
-            }
-
-            if(NSLogEvents::IsJsRTActionRootCall(evt))
-            {
-                const NSLogEvents::JsRTCallFunctionAction* rootEntry = NSLogEvents::GetInlineEventDataAs<NSLogEvents::JsRTCallFunctionAction, NSLogEvents::EventKind::CallExistingFunctionActionTag>(evt);
-
-                if(rootEntry->CallEventTime == etime)
-                {
-                    restoreEventTime = rootEntry->CallEventTime;
-                    snap = rootEntry->AdditionalReplayInfo->RtRSnap;
-                    break;
-                }
-            }
-        }
-        TTDAssert(snap != nullptr, "Log should start with a snapshot!!!");
-
         uint32 dbgScopeCount = snap->GetDbgScopeCountNonTopLevel();
 
         TTDIdentifierDictionary<uint64, NSSnapValues::TopLevelScriptLoadFunctionBodyResolveInfo*> topLevelLoadScriptMap;
@@ -1561,6 +1532,7 @@ namespace TTD
             reuseInflateMap = snap->AllWellKnownObjectsReusable(this->m_lastInflateMap);
         }
 
+        bool createdContexts = false;
         if(reuseInflateMap)
         {
             this->m_lastInflateMap->PrepForReInflate(snap->ContextCount(), snap->HandlerCount(), snap->TypeCount(), snap->PrimitiveCount() + snap->ObjectCount(), snap->BodyCount() + topFunctionCount, dbgScopeCount, snap->EnvCount(), snap->SlotArrayCount());
@@ -1568,28 +1540,26 @@ namespace TTD
             //collect anything that is dead
             threadCtx->ClearRootsForSnapRestore();
             this->m_threadContext->GetRecycler()->CollectNow<CollectNowForceInThread>();
-
-            //inflate into existing contexts
-            const JsUtil::List<Js::ScriptContext*, HeapAllocator>& oldCtxts = threadCtx->GetTTDContexts();
-            for(auto iter = snpCtxs.GetIterator(); iter.IsValid(); iter.MoveNext())
+        }
+        else if(!canCreateContexts)
+        {
+            //The host owns the live contexts so we start from a fresh map but still inflate into them
+            if(this->m_lastInflateMap != nullptr)
             {
-                const NSSnapValues::SnapContext* sCtx = iter.Current();
-                Js::ScriptContext* vCtx = nullptr;
-                for(int32 i = 0; i < oldCtxts.Count(); ++i)
-                {
-                    if(oldCtxts.Item(i)->ScriptContextLogTag == sCtx->ScriptContextLogId)
-                    {
-                        vCtx = oldCtxts.Item(i);
-                        break;
-                    }
-                }
-                TTDAssert(vCtx != nullptr, "We lost a context somehow!!!");
-
-                NSSnapValues::InflateScriptContext(sCtx, vCtx, this->m_lastInflateMap, topLevelLoadScriptMap, topLevelNewScriptMap, topLevelEvalScriptMap);
+                TT_HEAP_DELETE(InflateMap, this->m_lastInflateMap);
+                this->m_lastInflateMap = nullptr;
             }
+
+            this->m_lastInflateMap = TT_HEAP_NEW(InflateMap);
+            this->m_lastInflateMap->PrepForInitialInflate(this->m_threadContext, snap->ContextCount(), snap->HandlerCount(), snap->TypeCount(), snap->PrimitiveCount() + snap->ObjectCount(), snap->BodyCount() + topFunctionCount, dbgScopeCount, snap->EnvCount(), snap->SlotArrayCount());
+            this->m_lastInflateSnapshotTime = etime;
+
+            threadCtx->ClearRootsForSnapRestore();
         }
         else
         {
+            createdContexts = true;
+
             bool shouldReleaseCtxs = false;
             if(this->m_lastInflateMap != nullptr)
             {
@@ -1628,7 +1598,81 @@ namespace TTD
                 }
                 this->m_threadContext->GetRecycler()->CollectNow<CollectNowForceInThread>();
             }
+        }
+
+        if(!createdContexts)
+        {
+            //inflate into existing contexts
+            const JsUtil::List<Js::ScriptContext*, HeapAllocator>& oldCtxts = threadCtx->GetTTDContexts();
+            for(auto iter = snpCtxs.GetIterator(); iter.IsValid(); iter.MoveNext())
+            {
+                const NSSnapValues::SnapContext* sCtx = iter.Current();
+                Js::ScriptContext* vCtx = nullptr;
+                for(int32 i = 0; i < oldCtxts.Count(); ++i)
+                {
+                    if(oldCtxts.Item(i)->ScriptContextLogTag == sCtx->ScriptContextLogId)
+                    {
+                        vCtx = oldCtxts.Item(i);
+                        break;
+                    }
+                }
+                TTDAssert(vCtx != nullptr, "We lost a context somehow!!!");
+
+                NSSnapValues::InflateScriptContext(sCtx, vCtx, this->m_lastInflateMap, topLevelLoadScriptMap, topLevelNewScriptMap, topLevelEvalScriptMap);
+            }
+        }
 
+        this->SetSnapshotOrInflateInProgress(true); //make sure we don't do any un-intended CrossSite conversions
+
+        snap->Inflate(this->m_lastInflateMap, this->m_threadContext->TTDContext);
+        this->m_lastInflateMap->CleanupAfterInflate();
+
+        this->SetSnapshotOrInflateInProgress(false); //re-enable CrossSite conversions
+
+        return createdContexts;
+    }
+
+    void EventLog::DoSnapshotInflate(int64 etime)
+    {
+        this->PushMode(TTDMode::ExcludedExecutionTTAction);
+
+        const SnapShot* snap = nullptr;
+        int64 restoreEventTime = -1;
+
+        for(auto iter = this->m_eventList.GetIteratorAtLast_ReplayOnly(); iter.IsValid(); iter.MovePrevious_ReplayOnly())
+        {
+            NSLogEvents::EventLogEntry* evt = iter.Current();
+            if(evt->EventKind == NSLogEvents::EventKind::SnapshotTag)
+            {
+                NSLogEvents::SnapshotEventLogEntry* snapEvent = NSLogEvents::GetInlineEventDataAs<NSLogEvents::SnapshotEventLogEntry, NSLogEvents::EventKind::SnapshotTag>(evt);
+                if(snapEvent->RestoreTimestamp == etime)
+                {
+                    NSLogEvents::SnapshotEventLogEntry_EnsureSnapshotDeserialized(evt, this->m_threadContext);
+
+                    restoreEventTime = snapEvent->RestoreTimestamp;
+                    snap = snapEvent->Snap;
+                    break;
+                }
+            }
+
+            if(NSLogEvents::IsJsRTActionRootCall(evt))
+            {
+                const NSLogEvents::JsRTCallFunctionAction* rootEntry = NSLogEvents::GetInlineEventDataAs<NSLogEvents::JsRTCallFunctionAction, NSLogEvents::EventKind::CallExistingFunctionActionTag>(evt);
+
+                if(rootEntry->CallEventTime == etime)
+                {
+                    restoreEventTime = rootEntry->CallEventTime;
+                    snap = rootEntry->AdditionalReplayInfo->RtRSnap;
+                    break;
+                }
+            }
+        }
+        TTDAssert(snap != nullptr, "Log should start with a snapshot!!!");
+
+        bool createdContexts = this->DoSnapshotInflate_Helper(snap, etime, true);
+
+        if(createdContexts)
+        {
             //We don't want to have a bunch of snapshots in memory (that will get big fast) so unload all but the current one
             for(auto iter = this->m_eventList.GetIteratorAtLast_ReplayOnly(); iter.IsValid(); iter.MovePrevious_ReplayOnly())
             {
@@ -1652,13 +1696,6 @@ namespace TTD
             }
         }
 
-        this->SetSnapshotOrInflateInProgress(true); //make sure we don't do any un-intended CrossSite conversions
-
-        snap->Inflate(this->m_lastInflateMap, this->m_threadContext->TTDContext);
-        this->m_lastInflateMap->CleanupAfterInflate();
-
-        this->SetSnapshotOrInflateInProgress(false); //re-enable CrossSite conversions
-
         this->m_eventTimeCtr = restoreEventTime;
         if(!this->m_eventList.IsEmpty())
         {
@@ -1694,6 +1731,75 @@ namespace TTD
 #endif
     }
 
+    void EventLog::DoStartupSnapshotExtract()
+    {
+        //force a GC to get weak containers in a consistent state
+        this->m_threadContext->GetRecycler()->CollectNow<CollectNowForceInThread>();
+        this->m_threadContext->TTDContext->SyncRootsBeforeSnapshot_Record();
+
+        this->SetSnapshotOrInflateInProgress(true);
+        this->PushMode(TTDMode::ExcludedExecutionTTAction);
+
+        //Drop the old snapshot and anything we kept around to speed up re-inflating it
+        if(this->m_startupSnapshot != nullptr)
+        {
+            TT_HEAP_DELETE(SnapShot, this->m_startupSnapshot);
+            this->m_startupSnapshot = nullptr;
+        }
+
+        if(this->m_lastInflateMap != nullptr)
+        {
+            TT_HEAP_DELETE(InflateMap, this->m_lastInflateMap);
+            this->m_lastInflateMap = nullptr;
+        }
+
+        //This snapshot is owned by the log (not an event in it) so it survives the log being unloaded when recording stops
+        JsUtil::BaseHashSet<Js::FunctionBody*, HeapAllocator> liveTopLevelBodies(&HeapAllocator::Instance);
+        this->m_startupSnapshot = this->DoSnapshotExtract_Helper(0.0, liveTopLevelBodies);
+        this->m_startupSnapshotTime = this->GetLastEventTime();
+
+        this->PopMode(TTDMode::ExcludedExecutionTTAction);
+        this->SetSnapshotOrInflateInProgress(false);
+    }
+
+    bool EventLog::DoStartupSnapshotInflate()
+    {
+        if(this->m_startupSnapshot == nullptr)
+        {
+            return false;
+        }
+
+        //We only restore into the contexts the host already has so make sure all of them are still around
+        const JsUtil::List<Js::ScriptContext*, HeapAllocator>& liveCtxs = this->m_threadContext->TTDContext->GetTTDContexts();
+        for(auto iter = this->m_startupSnapshot->GetContextList().GetIterator(); iter.IsValid(); iter.MoveNext())
+        {
+            bool found = false;
+            for(int32 i = 0; i < liveCtxs.Count(); ++i)
+            {
+                found |= (liveCtxs.Item(i)->ScriptContextLogTag == iter.Current()->ScriptContextLogId);
+            }
+
+            if(!found)
+            {
+                return false;
+            }
+        }
+
+        this->PushMode(TTDMode::ExcludedExecutionTTAction);
+
+        this->DoSnapshotInflate_Helper(this->m_startupSnapshot, this->m_startupSnapshotTime, false);
+
+        this->PopMode(TTDMode::ExcludedExecutionTTAction);
+
+        //If we are actively recording then the log must see the reset as well so take a regular snapshot of the restored state
+        if((this->m_currentMode & TTDMode::CurrentlyEnabled) == TTDMode::CurrentlyEnabled)
+        {
+            this->DoSnapshotExtract();
+        }
+
+        return true;
+    }
+
     void EventLog::ReplayRootEventsToTime(int64 eventTime)
     {
         while(this->m_eventTimeCtr < eventTime)
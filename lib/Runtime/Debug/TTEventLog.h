@@ -238,6 +238,10 @@ namespace TTD
         int64 m_lastInflateSnapshotTime;
         InflateMap* m_lastInflateMap;
 
+        //A snapshot the host asked us to take once its contexts were fully initialized so it can cheaply reset them back to that state
+        SnapShot* m_startupSnapshot;
+        int64 m_startupSnapshotTime;
+
         //Pin set of all property records created during this logging session
         RecyclerRootPtr<PropertyRecordPinSet> m_propertyRecordPinSet;
         UnorderedArrayList<NSSnapType::SnapPropertyRecord, TTD_ARRAY_LIST_SIZE_DEFAULT> m_propertyRecordList;
@@ -268,6 +272,10 @@ namespace TTD
         //A helper for extracting snapshots
         SnapShot* DoSnapshotExtract_Helper(double gcTime, JsUtil::BaseHashSet<Js::FunctionBody*, HeapAllocator>& liveTopLevelBodies);
 
+        //A helper for inflating snapshots -- into the live contexts if we can reuse them (or are not allowed to create new ones) and into new contexts otherwise
+        //Return true if new contexts were created
+        bool DoSnapshotInflate_Helper(const SnapShot* snap, int64 etime, bool canCreateContexts);
+
         //Replay a snapshot event -- either just advance the event position or, if running diagnostics, take new snapshot and compare
         void ReplaySnapshotEvent();
 
@@ -490,6 +498,13 @@ namespace TTD
         //Do the inflation of the snapshot that is at the given event time
         void DoSnapshotInflate(int64 etime);
 
+        //Take a snapshot of the current (fully initialized) state of all the contexts that the host can later reset them back to
+        void DoStartupSnapshotExtract();
+
+        //Reset all the contexts back to the state in the startup snapshot
+        //Return false if there is no startup snapshot or a context it refers to has been destroyed
+        bool DoStartupSnapshotInflate();
+
         //Run execute top level event calls until the given time is reached
         void ReplayRootEventsToTime(int64 eventTime);
 
@@ -1694,7 +1694,10 @@ namespace TTD
                     intoCtx->TTDContextInfo->ProcessFunctionBodyOnLoad(fb, nullptr);
                     intoCtx->TTDContextInfo->RegisterLoadedScript(fb, cri.TopLevelBodyCtr);
 
-                    intoCtx->GetThreadContext()->TTDExecutionInfo->ProcessScriptLoad_InflateReuseBody(cri.TopLevelBodyCtr, fb);
+                    if(intoCtx->GetThreadContext()->TTDExecutionInfo != nullptr)
+                    {
+                        intoCtx->GetThreadContext()->TTDExecutionInfo->ProcessScriptLoad_InflateReuseBody(cri.TopLevelBodyCtr, fb);
+                    }
                 }
 
                 inflator->UpdateFBScopes(fbInfo->TopLevelBase.ScopeChainInfo, fb);
@@ -1720,7 +1723,10 @@ namespace TTD
                         intoCtx->TTDContextInfo->ProcessFunctionBodyOnLoad(fb, nullptr);
                         intoCtx->TTDContextInfo->RegisterNewScript(fb, cri.TopLevelBodyCtr);
 
-                        intoCtx->GetThreadContext()->TTDExecutionInfo->ProcessScriptLoad_InflateReuseBody(cri.TopLevelBodyCtr, fb);
+                        if(intoCtx->GetThreadContext()->TTDExecutionInfo != nullptr)
+                        {
+                            intoCtx->GetThreadContext()->TTDExecutionInfo->ProcessScriptLoad_InflateReuseBody(cri.TopLevelBodyCtr, fb);
+                        }
                     }
 
                     inflator->UpdateFBScopes(fbInfo->TopLevelBase.ScopeChainInfo, fb);
@@ -1743,7 +1749,10 @@ namespace TTD
                         intoCtx->TTDContextInfo->ProcessFunctionBodyOnLoad(fb, nullptr);
                         intoCtx->TTDContextInfo->RegisterEvalScript(fb, cri.TopLevelBodyCtr);
 
-                        intoCtx->GetThreadContext()->TTDExecutionInfo->ProcessScriptLoad_InflateReuseBody(cri.TopLevelBodyCtr, fb);
+                        if(intoCtx->GetThreadContext()->TTDExecutionInfo != nullptr)
+                        {
+                            intoCtx->GetThreadContext()->TTDExecutionInfo->ProcessScriptLoad_InflateReuseBody(cri.TopLevelBodyCtr, fb);
+                        }
                     }
 
                     inflator->UpdateFBScopes(fbInfo->TopLevelBase.ScopeChainInfo, fb);
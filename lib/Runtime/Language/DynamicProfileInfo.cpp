@@ -7,12 +7,10 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
     }
-#endif
 
     struct Allocation
     {
@@ -1446,6 +1444,7 @@ namespace Js
         // Need to verify that the function body matches with the profile info
         Assert(this->dynamicProfileFunctionInfo);
         if (this->dynamicProfileFunctionInfo->paramInfoCount != functionBody->GetProfiledInParamsCount()
+            || this->dynamicProfileFunctionInfo->ldLenInfoCount != functionBody->GetProfiledLdLenCount()
             || this->dynamicProfileFunctionInfo->ldElemInfoCount != functionBody->GetProfiledLdElemCount()
             || this->dynamicProfileFunctionInfo->stElemInfoCount != functionBody->GetProfiledStElemCount()
             || this->dynamicProfileFunctionInfo->arrayCallSiteCount != functionBody->GetProfiledArrayCallSiteCount()
@@ -2076,25 +2075,23 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
 #if DBG_DUMP
-    void BufferWriter::Log(DynamicProfileInfo* info)
+    void BufferWriter::Log(DynamicProfileInfo* info, FunctionBody* functionBody)
     {
-        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, info->GetFunctionBody()->GetSourceContextId(), info->GetFunctionBody()->GetLocalFunctionId()))
+        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, functionBody->GetSourceContextId(), functionBody->GetLocalFunctionId()))
         {
             Output::Print(_u("Saving:"));
-            info->Dump(info->GetFunctionBody());
+            info->Dump(functionBody);
         }
     }
 #endif
 
     template <typename T>
-    bool DynamicProfileInfo::Serialize(T * writer)
+    bool DynamicProfileInfo::Serialize(T * writer, FunctionBody * functionBody)
     {
 #if DBG_DUMP
-        writer->Log(this);
+        writer->Log(this, functionBody);
 #endif
-        FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
@@ -2171,14 +2168,17 @@ namespace Js
 
             if (!reader->Read(functionId))
             {
-                AssertOrFailFast(false);
-                return nullptr;
+                goto Error;
             }
 
             if (!reader->Read(&paramInfoCount))
             {
-                AssertOrFailFast(false);
-                return nullptr;
+                goto Error;
+            }
+
+            if (!reader->CanReadArray(paramInfoCount, sizeof(ValueType)))
+            {
+                goto Error;
             }
 
             if (paramInfoCount != 0)
@@ -2195,6 +2195,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(ldLenInfoCount, sizeof(LdLenInfo)))
+            {
+                goto Error;
+            }
+
             if (ldLenInfoCount != 0)
             {
                 ldLenInfo = RecyclerNewArrayLeaf(recycler, LdLenInfo, ldLenInfoCount);
@@ -2209,6 +2214,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(ldElemInfoCount, sizeof(LdElemInfo)))
+            {
+                goto Error;
+            }
+
             if (ldElemInfoCount != 0)
             {
                 ldElemInfo = RecyclerNewArrayLeaf(recycler, LdElemInfo, ldElemInfoCount);
@@ -2223,6 +2233,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(stElemInfoCount, sizeof(StElemInfo)))
+            {
+                goto Error;
+            }
+
             if (stElemInfoCount != 0)
             {
                 stElemInfo = RecyclerNewArrayLeaf(recycler, StElemInfo, stElemInfoCount);
@@ -2237,6 +2252,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(arrayCallSiteCount, sizeof(ArrayCallSiteInfo)))
+            {
+                goto Error;
+            }
+
             if (arrayCallSiteCount != 0)
             {
                 arrayCallSiteInfo = RecyclerNewArrayLeaf(recycler, ArrayCallSiteInfo, arrayCallSiteCount);
@@ -2251,6 +2271,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(fldInfoCount, sizeof(FldInfo)))
+            {
+                goto Error;
+            }
+
             if (fldInfoCount != 0)
             {
                 fldInfo = RecyclerNewArrayLeaf(recycler, FldInfo, fldInfoCount);
@@ -2265,6 +2290,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(slotInfoCount, sizeof(ValueType)))
+            {
+                goto Error;
+            }
+
             if (slotInfoCount != 0)
             {
                 slotInfo = RecyclerNewArrayLeaf(recycler, ValueType, slotInfoCount);
@@ -2279,6 +2309,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(callSiteInfoCount, sizeof(CallSiteInfo)))
+            {
+                goto Error;
+            }
+
             if (callSiteInfoCount != 0)
             {
                 // CallSiteInfo contains pointer "polymorphicCallSiteInfo", but
@@ -2296,6 +2331,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(divCount, sizeof(ValueType)))
+            {
+                goto Error;
+            }
+
             if (divCount != 0)
             {
                 divTypeInfo = RecyclerNewArrayLeaf(recycler, ValueType, divCount);
@@ -2310,6 +2350,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(switchCount, sizeof(ValueType)))
+            {
+                goto Error;
+            }
+
             if (switchCount != 0)
             {
                 switchTypeInfo = RecyclerNewArrayLeaf(recycler, ValueType, switchCount);
@@ -2324,6 +2369,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(returnTypeInfoCount, sizeof(ValueType)))
+            {
+                goto Error;
+            }
+
             if (returnTypeInfoCount != 0)
             {
                 returnTypeInfo = RecyclerNewArrayLeaf(recycler, ValueType, returnTypeInfoCount);
@@ -2338,6 +2388,11 @@ namespace Js
                 goto Error;
             }
 
+            if (!reader->CanReadArray(loopCount, sizeof(ImplicitCallFlags)))
+            {
+                goto Error;
+            }
+
             if (loopCount != 0)
             {
                 loopImplicitCallFlags = RecyclerNewArrayLeaf(recycler, ImplicitCallFlags, loopCount);
@@ -2357,6 +2412,12 @@ namespace Js
 
             if (loopCount != 0)
             {
+                if (loopCount > UINT_MAX / LoopFlags::COUNT
+                    || !reader->CanReadArray(BVFixed::WordCount(loopCount * LoopFlags::COUNT), sizeof(BVUnit)))
+                {
+                    goto Error;
+                }
+
                 loopFlags = BVFixed::New(loopCount * LoopFlags::COUNT, recycler);
                 if (!reader->ReadArray(loopFlags->GetData(), loopFlags->WordCount()))
                 {
@@ -2408,15 +2469,16 @@ namespace Js
         }
 
     Error:
-        AssertOrFailFast(false);
+        // The buffer may come from the host, so a truncated or corrupt profile isn't an engine bug
         return nullptr;
     }
 
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
     template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
-    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
-    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
+    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*, FunctionBody*);
+    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*, FunctionBody*);
 
+#ifdef DYNAMIC_PROFILE_STORAGE
     void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
     {
         // We don't clear old dynamic data here, because if a function is inlined, it will never go through the
@@ -595,6 +595,7 @@ namespace Js
             Field(bool) disableTagCheck : 1;
             Field(bool) disableOptimizeTryFinally : 1;
             Field(bool) disableFieldPRE : 1;
+            Field(bool) wasFullJitted : 1;
         };
         Field(Bits) bits;
 
@@ -653,15 +654,15 @@ namespace Js
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(FunctionBody *) functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
         // Used by de-serialize
         DynamicProfileInfo();
 
         template <typename T>
         static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, Js::LocalFunctionId * functionId);
         template <typename T>
-        bool Serialize(T * writer);
+        bool Serialize(T * writer, FunctionBody * functionBody);
 
+#ifdef DYNAMIC_PROFILE_STORAGE
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
@@ -758,6 +759,8 @@ namespace Js
         void DisableCheckThis() { this->bits.disableCheckThis = true; }
         bool IsLoopImplicitCallInfoDisabled() const { return this->bits.disableLoopImplicitCallInfo; }
         void DisableLoopImplicitCallInfo() { this->bits.disableLoopImplicitCallInfo = true; }
+        bool WasFullJitted() const { return this->bits.wasFullJitted; }
+        void SetWasFullJitted() { this->bits.wasFullJitted = true; }
 
         bool IsArrayCheckHoistDisabled(const bool isJitLoopBody) const
         {
@@ -939,7 +942,6 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
     class BufferReader
     {
     public:
@@ -950,10 +952,9 @@ namespace Js
         {
             if (lengthLeft < sizeof(T))
             {
-                AssertOrFailFast(false);
                 return false;
             }
-            *data = *(T *)current;
+            memcpy_s(data, sizeof(T), current, sizeof(T));
             current += sizeof(T);
             lengthLeft -= sizeof(T);
             return true;
@@ -966,24 +967,30 @@ namespace Js
             {
                 return false;
             }
-            *data = *(T *)current;
+            memcpy_s(data, sizeof(T), current, sizeof(T));
             return true;
         }
 
         template <typename T>
         bool ReadArray(__inout_ecount(len) T * data, size_t len)
         {
-            size_t size = sizeof(T) * len;
-            if (lengthLeft < size)
+            if (!CanReadArray(len, sizeof(T)))
             {
-                AssertOrFailFast(false);
                 return false;
             }
+            size_t size = sizeof(T) * len;
             memcpy_s(data, size, current, size);
             current += size;
             lengthLeft -= size;
             return true;
         }
+
+        // The buffer may come from the host, so counts read from it are checked against the bytes left
+        // before anything is allocated for them
+        bool CanReadArray(size_t len, size_t elementSize) const
+        {
+            return len <= lengthLeft / elementSize;
+        }
     private:
         char const * current;
         size_t lengthLeft;
@@ -1001,7 +1008,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info) {}
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody) {}
 #endif
 
         template <typename T>
@@ -1033,7 +1040,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info);
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody);
 #endif
         template <typename T>
         bool WriteArray(__in_ecount(len) T * data, size_t len)
@@ -1059,6 +1066,5 @@ namespace Js
         char * current;
         size_t lengthLeft;
     };
-#endif
 };
 #endif
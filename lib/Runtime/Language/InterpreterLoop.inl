@@ -37,6 +37,29 @@
 #define PROFILEDOP(prof, unprof) unprof
 #endif
 
+// The plain javascript loops dispatch through a table of handler label addresses, with a copy of the
+// dispatch at the end of each handler, so that every handler gets its own indirect branch to predict.
+// The debugging loops keep the switch since they do extra work before every opcode.
+#if ENABLE_INTERPRETER_THREADED_DISPATCH && !defined(INTERPRETER_ASMJS) && !DEBUGGING_LOOP
+#define INTERPRETER_THREADED_DISPATCH 1
+#else
+#define INTERPRETER_THREADED_DISPATCH 0
+#endif
+
+#if ENABLE_TTD && !defined(INTERPRETER_ASMJS)
+//In case where we don't have a BP set at the final statemnt
+#define CHECK_REPLAY_SOURCE_INFO(op) \
+        if(this->scriptContext->ShouldPerformReplayDebuggerAction()) \
+        { \
+            if(op != INTERPRETER_OPCODE::Break) \
+            { \
+                this->scriptContext->GetThreadContext()->TTDExecutionInfo->ManageLastSourceInfoChecks(this->m_functionBody, false); \
+            } \
+        }
+#else
+#define CHECK_REPLAY_SOURCE_INFO(op)
+#endif
+
 //two layers of macros are necessary to get arguments to the invocation of the top level macro expanded.
 #define CONCAT_TOKENS_AGAIN(loopName, fnSuffix) loopName ## fnSuffix
 #define CONCAT_TOKENS(loopName, fnSuffix) CONCAT_TOKENS_AGAIN(loopName, fnSuffix)
@@ -172,6 +195,64 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
     Assert(this->returnAddress != nullptr);
     AssertMsg(!this->GetFunctionBody()->GetUsesArgumentsObject() || m_arguments == NULL || Js::ArgumentsObject::Is(m_arguments), "Bad arguments!");
 
+#if INTERPRETER_THREADED_DISPATCH
+    // Handler addresses indexed by opcode. Label addresses can only be taken in this function, so the table is filled
+    // on first use by the thread that claims it, and other threads wait until it is published.
+    enum { ThreadedDispatchTableEmpty, ThreadedDispatchTableFilling, ThreadedDispatchTableReady };
+    static void* threadedDispatchTable[256];
+    static int threadedDispatchTableState = ThreadedDispatchTableEmpty;
+    if (__atomic_load_n(&threadedDispatchTableState, __ATOMIC_ACQUIRE) != ThreadedDispatchTableReady)
+    {
+        int expectedState = ThreadedDispatchTableEmpty;
+        if (__atomic_compare_exchange_n(&threadedDispatchTableState, &expectedState, ThreadedDispatchTableFilling, false, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+        {
+            for (uint i = 0; i < _countof(threadedDispatchTable); i++)
+            {
+                threadedDispatchTable[i] = &&InterpreterOp_Default;
+            }
+
+#define THREADED_DISPATCH_ENTRY(name) \
+            CompileAssert((uint)INTERPRETER_OPCODE::name < _countof(threadedDispatchTable)); \
+            threadedDispatchTable[(uint)INTERPRETER_OPCODE::name] = &&InterpreterOp_##name;
+#define DEF2(x, op, func) THREADED_DISPATCH_ENTRY(op)
+#define DEF3(x, op, func, y) THREADED_DISPATCH_ENTRY(op)
+#define DEF2_WMS(x, op, func) THREADED_DISPATCH_ENTRY(op)
+#define DEF3_WMS(x, op, func, y) THREADED_DISPATCH_ENTRY(op)
+#define DEF4_WMS(x, op, func, y, t) THREADED_DISPATCH_ENTRY(op)
+#include "InterpreterHandler.inl"
+            THREADED_DISPATCH_ENTRY(Ret)
+            THREADED_DISPATCH_ENTRY(Yield)
+            THREADED_DISPATCH_ENTRY(Leave)
+            THREADED_DISPATCH_ENTRY(LeaveNull)
+            THREADED_DISPATCH_ENTRY(ExtendedOpcodePrefix)
+            THREADED_DISPATCH_ENTRY(ExtendedMediumLayoutPrefix)
+            THREADED_DISPATCH_ENTRY(ExtendedLargeLayoutPrefix)
+            THREADED_DISPATCH_ENTRY(MediumLayoutPrefix)
+            THREADED_DISPATCH_ENTRY(LargeLayoutPrefix)
+            THREADED_DISPATCH_ENTRY(EndOfBlock)
+            THREADED_DISPATCH_ENTRY(Break)
+#undef THREADED_DISPATCH_ENTRY
+
+            __atomic_store_n(&threadedDispatchTableState, ThreadedDispatchTableReady, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            while (__atomic_load_n(&threadedDispatchTableState, __ATOMIC_ACQUIRE) != ThreadedDispatchTableReady)
+            {
+                YieldProcessor();
+            }
+        }
+    }
+
+#undef PROCESS_OPCODE_LABEL
+#undef PROCESS_NEXT_OPCODE
+#define PROCESS_OPCODE_LABEL(name) InterpreterOp_##name:
+#define PROCESS_NEXT_OPCODE() \
+        op = READ_OP(ip); \
+        CHECK_REPLAY_SOURCE_INFO(op); \
+        goto *threadedDispatchTable[(uint)op]
+#endif
+
     // IP Passing in the interpreter:
     // We keep a local copy of the bytecode's instruction pointer and
     // pass it by reference to the bytecode reader.
@@ -187,18 +268,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
     {
         INTERPRETER_OPCODE op = READ_OP(ip);
 
-#ifndef INTERPRETER_ASMJS
-#if ENABLE_TTD
-        //In case where we don't have a BP set at the final statemnt
-        if(this->scriptContext->ShouldPerformReplayDebuggerAction())
-        {
-            if(op != INTERPRETER_OPCODE::Break)
-            {
-                this->scriptContext->GetThreadContext()->TTDExecutionInfo->ManageLastSourceInfoChecks(this->m_functionBody, false);
-            }
-        }
-#endif
-#endif
+        CHECK_REPLAY_SOURCE_INFO(op);
 
 #if DEBUGGING_LOOP
         if (this->scriptContext->GetThreadContext()->GetDebugManager()->stepController.IsActive() &&
@@ -288,7 +358,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #endif
         switch (op)
         {
-        case INTERPRETER_OPCODE::Ret:
+        case INTERPRETER_OPCODE::Ret: PROCESS_OPCODE_LABEL(Ret)
             {
                 //
                 // Return "Reg: 0" as the return-value.
@@ -305,7 +375,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
 
 #ifndef INTERPRETER_ASMJS
-        case INTERPRETER_OPCODE::Yield:
+        case INTERPRETER_OPCODE::Yield: PROCESS_OPCODE_LABEL(Yield)
             {
                 m_reader.Reg2_Small(ip);
                 return GetReg(GetFunctionBody()->GetYieldRegister());
@@ -321,13 +391,13 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #include "InterpreterHandler.inl"
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Leave:
+            case INTERPRETER_OPCODE::Leave: PROCESS_OPCODE_LABEL(Leave)
                 // Return the continuation address to the helper.
                 // This tells the helper that control left the scope without completing the try/handler,
                 // which is particularly significant when executing a finally.
                 m_reader.Empty(ip);
                 return (Var)this->m_reader.GetCurrentOffset();
-            case INTERPRETER_OPCODE::LeaveNull:
+            case INTERPRETER_OPCODE::LeaveNull: PROCESS_OPCODE_LABEL(LeaveNull)
                 // Return to the helper without specifying a continuation address,
                 // indicating that the handler completed without jumping, so exception processing
                 // should continue.
@@ -349,33 +419,33 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #endif
 
 #define ExtendedCase(opcode) \
-            case INTERPRETER_OPCODE::opcode: \
+            case INTERPRETER_OPCODE::opcode: PROCESS_OPCODE_LABEL(opcode) \
                 ip = PROCESS_OPCODE_FN_NAME(opcode)(ip); \
                 CHECK_SWITCH_PROFILE_MODE(); \
-                break;
+                PROCESS_NEXT_OPCODE();
             ExtendedCase(ExtendedOpcodePrefix)
             ExtendedCase(ExtendedMediumLayoutPrefix)
             ExtendedCase(ExtendedLargeLayoutPrefix)
 
-            case INTERPRETER_OPCODE::MediumLayoutPrefix:
+            case INTERPRETER_OPCODE::MediumLayoutPrefix: PROCESS_OPCODE_LABEL(MediumLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(MediumLayoutPrefix)(ip, yieldValue);
                 CHECK_YIELD_VALUE();
                 CHECK_SWITCH_PROFILE_MODE();
-                break;
+                PROCESS_NEXT_OPCODE();
             }
 
-            case INTERPRETER_OPCODE::LargeLayoutPrefix:
+            case INTERPRETER_OPCODE::LargeLayoutPrefix: PROCESS_OPCODE_LABEL(LargeLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(LargeLayoutPrefix)(ip, yieldValue);
                 CHECK_YIELD_VALUE();
                 CHECK_SWITCH_PROFILE_MODE();
-                break;
+                PROCESS_NEXT_OPCODE();
             }
 
-            case INTERPRETER_OPCODE::EndOfBlock:
+            case INTERPRETER_OPCODE::EndOfBlock: PROCESS_OPCODE_LABEL(EndOfBlock)
             {
                 // Note that at this time though ip was advanced by 'OpCode op = ReadByteOp<INTERPRETER_OPCODE>(ip)',
                 // we haven't advanced m_reader.m_currentLocation yet, thus m_reader.m_currentLocation still points to EndOfBLock,
@@ -401,7 +471,7 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Break:
+            case INTERPRETER_OPCODE::Break: PROCESS_OPCODE_LABEL(Break)
             {
 #if DEBUGGING_LOOP
                 // The reader has already advanced the IP:
@@ -488,10 +558,10 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 #else
                 m_reader.Empty(ip);
 #endif
-                break;
+                PROCESS_NEXT_OPCODE();
             }
 #endif
-            default:
+            default: PROCESS_OPCODE_LABEL(Default)
                 // Help the C++ optimizer by declaring that the cases we
                 // have above are sufficient
                 AssertMsg(false, "dispatch to bad opcode");
@@ -503,6 +573,14 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
 // Restore optimizations to what's specified by the /O switch.
 #pragma optimize("", on)
 #endif
+#if INTERPRETER_THREADED_DISPATCH
+#undef PROCESS_OPCODE_LABEL
+#undef PROCESS_NEXT_OPCODE
+#define PROCESS_OPCODE_LABEL(name)
+#define PROCESS_NEXT_OPCODE() break
+#endif
+#undef INTERPRETER_THREADED_DISPATCH
+#undef CHECK_REPLAY_SOURCE_INFO
 #undef READ_OP
 #undef READ_EXT_OP
 #undef TRACING_FUNC
@@ -4996,6 +4996,228 @@ using namespace Js;
         JIT_HELPER_END(Op_Memset);
     }
 
+    // Element-wise kernels for OP_MemArith. Each traits class computes one element the way script would for its
+    // element type. The operation is picked outside of the loops and the loops have no early exits, so that the
+    // C++ compiler can vectorize them.
+    template <typename T>
+    struct MemArithFloatTraits
+    {
+        // Script computes in double and rounds once when storing, even for Float32Array
+        typedef double OperandType;
+        static OperandType FromElement(T value) { return value; }
+        static T Add(T x, OperandType y) { return static_cast<T>(static_cast<double>(x) + y); }
+        static T Sub(T x, OperandType y) { return static_cast<T>(static_cast<double>(x) - y); }
+        static T Mul(T x, OperandType y) { return static_cast<T>(static_cast<double>(x) * y); }
+    };
+
+    template <typename T>
+    struct MemArithWrapTraits
+    {
+        // Storing truncates to the element size, so integer operations can be done modulo 2^32
+        typedef uint32 OperandType;
+        static OperandType FromElement(T value) { return static_cast<uint32>(value); }
+        static T Add(T x, OperandType y) { return static_cast<T>(static_cast<uint32>(x) + y); }
+        static T Sub(T x, OperandType y) { return static_cast<T>(static_cast<uint32>(x) - y); }
+        static T Mul(T x, OperandType y)
+        {
+            // Only matches script for elements narrower than 32 bits, whose products are exact in double
+            Assert(sizeof(T) < sizeof(uint32));
+            return static_cast<T>(static_cast<uint32>(x) * y);
+        }
+    };
+
+    template <typename T>
+    struct MemArithInt32MulTraits
+    {
+        // The product of two 32-bit elements may not be exact in double, so do it the way script does
+        typedef double OperandType;
+        static OperandType FromElement(T value) { return value; }
+        static T Mul(T x, OperandType y) { return static_cast<T>(JavascriptConversion::ToInt32(static_cast<double>(x) * y)); }
+    };
+
+    struct MemArithClampedTraits
+    {
+        typedef int32 OperandType;
+        static OperandType FromElement(uint8 value) { return value; }
+        static uint8 Clamp(int64 value) { return static_cast<uint8>(value < 0 ? 0 : value > UINT8_MAX ? UINT8_MAX : value); }
+        static uint8 Add(uint8 x, OperandType y) { return Clamp(static_cast<int64>(x) + y); }
+        static uint8 Sub(uint8 x, OperandType y) { return Clamp(static_cast<int64>(x) - y); }
+        static uint8 Mul(uint8 x, OperandType y) { return Clamp(static_cast<int64>(x) * y); }
+    };
+
+    template <typename T, typename TTraits, T (*Operation)(T, typename TTraits::OperandType)>
+    static void MemArithLoop(T* dst, const T* src, const T* operand, typename TTraits::OperandType scalar, uint32 length)
+    {
+        if (operand != nullptr)
+        {
+            for (uint32 i = 0; i < length; i++)
+            {
+                dst[i] = Operation(src[i], TTraits::FromElement(operand[i]));
+            }
+        }
+        else
+        {
+            for (uint32 i = 0; i < length; i++)
+            {
+                dst[i] = Operation(src[i], scalar);
+            }
+        }
+    }
+
+    template <typename T, typename TTraits>
+    static void MemArithElements(JavascriptOperators::MemArithOperation operation, T* dst, const T* src, const T* operand, typename TTraits::OperandType scalar, uint32 length)
+    {
+        switch (operation)
+        {
+        case JavascriptOperators::MemArithAdd:
+            MemArithLoop<T, TTraits, TTraits::Add>(dst, src, operand, scalar, length);
+            break;
+        case JavascriptOperators::MemArithSub:
+            MemArithLoop<T, TTraits, TTraits::Sub>(dst, src, operand, scalar, length);
+            break;
+        case JavascriptOperators::MemArithMul:
+            MemArithLoop<T, TTraits, TTraits::Mul>(dst, src, operand, scalar, length);
+            break;
+        default:
+            Assert(UNREACHED);
+            break;
+        }
+    }
+
+    template <typename T>
+    static void MemArithWrapElements(JavascriptOperators::MemArithOperation operation, T* dst, const T* src, const T* operand, double scalar, uint32 length)
+    {
+        if (operation == JavascriptOperators::MemArithMul && sizeof(T) == sizeof(uint32))
+        {
+            MemArithLoop<T, MemArithInt32MulTraits<T>, MemArithInt32MulTraits<T>::Mul>(dst, src, operand, scalar, length);
+            return;
+        }
+
+        // The scalar was checked to be an int32 by the caller, so it is exact modulo 2^32
+        const uint32 wrappedScalar = static_cast<uint32>(static_cast<int32>(scalar));
+        switch (operation)
+        {
+        case JavascriptOperators::MemArithAdd:
+            MemArithLoop<T, MemArithWrapTraits<T>, MemArithWrapTraits<T>::Add>(dst, src, operand, wrappedScalar, length);
+            break;
+        case JavascriptOperators::MemArithSub:
+            MemArithLoop<T, MemArithWrapTraits<T>, MemArithWrapTraits<T>::Sub>(dst, src, operand, wrappedScalar, length);
+            break;
+        case JavascriptOperators::MemArithMul:
+            MemArithLoop<T, MemArithWrapTraits<T>, MemArithWrapTraits<T>::Mul>(dst, src, operand, wrappedScalar, length);
+            break;
+        default:
+            Assert(UNREACHED);
+            break;
+        }
+    }
+
+    BOOL JavascriptOperators::OP_MemArith(int32 operation, Var dstInstance, int32 dstStart, Var srcInstance, int32 srcStart, Var operand, int32 length, ScriptContext* scriptContext)
+    {
+        JIT_HELPER_NOT_REENTRANT_HEADER(Op_MemArith, reentrancylock, scriptContext->GetThreadContext());
+        if (length <= 0 || dstStart < 0 || srcStart != dstStart)
+        {
+            return false;
+        }
+
+        const TypeId instanceType = JavascriptOperators::GetTypeId(dstInstance);
+        if (!TypedArrayBase::Is(instanceType) || JavascriptOperators::GetTypeId(srcInstance) != instanceType)
+        {
+            return false;
+        }
+
+        // The operand is either another typed array of the same type, indexed like the source, or a number
+        TypedArrayBase* operandArray = nullptr;
+        double scalar = 0;
+        if (TaggedInt::Is(operand))
+        {
+            scalar = TaggedInt::ToDouble(operand);
+        }
+        else if (JavascriptNumber::Is(operand))
+        {
+            scalar = JavascriptNumber::GetValue(operand);
+        }
+        else if (JavascriptOperators::GetTypeId(operand) == instanceType)
+        {
+            operandArray = TypedArrayBase::UnsafeFromVar(operand);
+        }
+        else
+        {
+            return false;
+        }
+
+        int32 intScalar = 0;
+        if (!operandArray && instanceType != TypeIds_Float32Array && instanceType != TypeIds_Float64Array &&
+            !JavascriptNumber::TryGetInt32Value<true>(scalar, &intScalar))
+        {
+            return false;
+        }
+
+        TypedArrayBase* dstArray = TypedArrayBase::UnsafeFromVar(dstInstance);
+        TypedArrayBase* srcArray = TypedArrayBase::UnsafeFromVar(srcInstance);
+
+        // Leave out of range accesses and detached buffers to the interpreter. A detached buffer has no length.
+        const uint32 start = static_cast<uint32>(dstStart);
+        const uint32 end = start + static_cast<uint32>(length);
+        if (end > dstArray->GetLength() || end > srcArray->GetLength() || (operandArray && end > operandArray->GetLength()))
+        {
+            return false;
+        }
+
+        // Element i of the destination may only alias element i of a source. Anything else would make a
+        // later iteration read what an earlier one wrote.
+        const uint32 elementSize = dstArray->GetBytesPerElement();
+        const byte* dstBegin = dstArray->GetByteBuffer() + start * elementSize;
+        const byte* dstEnd = dstArray->GetByteBuffer() + end * elementSize;
+        const auto overlapsPartially = [&](TypedArrayBase* array)
+        {
+            const byte* begin = array->GetByteBuffer() + start * elementSize;
+            const byte* arrayEnd = array->GetByteBuffer() + end * elementSize;
+            return begin != dstBegin && begin < dstEnd && dstBegin < arrayEnd;
+        };
+        if (overlapsPartially(srcArray) || (operandArray && overlapsPartially(operandArray)))
+        {
+            return false;
+        }
+
+        const MemArithOperation op = static_cast<MemArithOperation>(operation);
+#define MEMARITH_ELEMENTS(type, call) \
+        { \
+            type* dst = reinterpret_cast<type*>(dstArray->GetByteBuffer()) + start; \
+            const type* src = reinterpret_cast<const type*>(srcArray->GetByteBuffer()) + start; \
+            const type* operandElements = operandArray ? reinterpret_cast<const type*>(operandArray->GetByteBuffer()) + start : nullptr; \
+            call; \
+            break; \
+        }
+        switch (instanceType)
+        {
+        case TypeIds_Int8Array:
+            MEMARITH_ELEMENTS(int8, MemArithWrapElements<int8>(op, dst, src, operandElements, intScalar, length))
+        case TypeIds_Uint8Array:
+            MEMARITH_ELEMENTS(uint8, MemArithWrapElements<uint8>(op, dst, src, operandElements, intScalar, length))
+        case TypeIds_Uint8ClampedArray:
+            MEMARITH_ELEMENTS(uint8, (MemArithElements<uint8, MemArithClampedTraits>(op, dst, src, operandElements, intScalar, length)))
+        case TypeIds_Int16Array:
+            MEMARITH_ELEMENTS(int16, MemArithWrapElements<int16>(op, dst, src, operandElements, intScalar, length))
+        case TypeIds_Uint16Array:
+            MEMARITH_ELEMENTS(uint16, MemArithWrapElements<uint16>(op, dst, src, operandElements, intScalar, length))
+        case TypeIds_Int32Array:
+            MEMARITH_ELEMENTS(int32, MemArithWrapElements<int32>(op, dst, src, operandElements, intScalar, length))
+        case TypeIds_Uint32Array:
+            MEMARITH_ELEMENTS(uint32, MemArithWrapElements<uint32>(op, dst, src, operandElements, intScalar, length))
+        case TypeIds_Float32Array:
+            MEMARITH_ELEMENTS(float, (MemArithElements<float, MemArithFloatTraits<float>>(op, dst, src, operandElements, scalar, length)))
+        case TypeIds_Float64Array:
+            MEMARITH_ELEMENTS(double, (MemArithElements<double, MemArithFloatTraits<double>>(op, dst, src, operandElements, scalar, length)))
+        default:
+            AssertMsg(false, "We don't support this type for element-wise memop yet.");
+            return false;
+        }
+#undef MEMARITH_ELEMENTS
+        return true;
+        JIT_HELPER_END(Op_MemArith);
+    }
+
     Var JavascriptOperators::OP_DeleteElementI_UInt32(Var instance, uint32 index, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags)
     {
         JIT_HELPER_REENTRANT_HEADER(Op_DeleteElementI_UInt32);
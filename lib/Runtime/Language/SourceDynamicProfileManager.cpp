@@ -314,31 +314,35 @@ namespace Js
         Assert(dynamicProfileInfo->GetFunctionBody()->HasExecutionDynamicProfileInfo());
         this->AddSavingItem(functionId, dynamicProfileInfo);
     }
+#endif
 
     template <typename T>
     SourceDynamicProfileManager *
     SourceDynamicProfileManager::Deserialize(T * reader, Recycler* recycler)
     {
+        // The buffer may come from the host (JsSetSerializedProfile), so every count and function id is checked
+        // against the data and a corrupt profile is rejected rather than asserted on.
         uint functionCount;
-        if (!reader->Peek(&functionCount))
+        if (!reader->Peek(&functionCount) || functionCount > MAX_FUNCTION_COUNT
+            || !reader->CanReadArray(BVFixed::GetAllocSize(functionCount), sizeof(char)))
         {
-            Assert(false);
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load failed. Invalid function count\n"));
             return nullptr;
         }
 
         BVFixed * startupFunctions = BVFixed::New(functionCount, recycler);
         if (!reader->ReadArray(((char *)startupFunctions),
-            BVFixed::GetAllocSize(functionCount)))
+            BVFixed::GetAllocSize(functionCount)) || startupFunctions->Length() != functionCount)
         {
-            Assert(false);
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load failed. Invalid startup functions\n"));
             return nullptr;
         }
 
         uint profileCount;
 
-        if (!reader->Read(&profileCount))
+        if (!reader->Read(&profileCount) || profileCount > functionCount)
         {
-            Assert(false);
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load failed. Invalid profile count\n"));
             return nullptr;
         }
 
@@ -360,17 +364,22 @@ namespace Js
         {
             Js::LocalFunctionId functionId;
             DynamicProfileInfo * dynamicProfileInfo = DynamicProfileInfo::Deserialize(reader, recycler, &functionId);
-            if (dynamicProfileInfo == nullptr || functionId >= functionCount)
+            if (dynamicProfileInfo == nullptr || functionId >= functionCount
+                || sourceDynamicProfileManager->dynamicProfileInfoMap.ContainsKey(functionId))
             {
-                Assert(false);
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load failed. Invalid profile for function %d\n"), i);
                 return nullptr;
             }
             sourceDynamicProfileManager->dynamicProfileInfoMap.Add(functionId, dynamicProfileInfo);
+#ifdef DYNAMIC_PROFILE_STORAGE
             sourceDynamicProfileManager->AddSavingItem(functionId, dynamicProfileInfo);
+#endif
         }
         return sourceDynamicProfileManager;
     }
 
+#ifdef DYNAMIC_PROFILE_STORAGE
+
     template <typename T>
     bool
     SourceDynamicProfileManager::Serialize(T * writer)
@@ -412,7 +421,7 @@ namespace Js
                 continue;
             }
 
-            if (!dynamicProfileInfo->Serialize(writer))
+            if (!dynamicProfileInfo->Serialize(writer, dynamicProfileInfo->GetFunctionBody()))
             {
                 return false;
             }
@@ -453,7 +462,152 @@ namespace Js
 
         DynamicProfileStorage::SaveRecord(url, record);
     }
-
 #endif
+
+    //
+    // Host driven profile persistence (JsSerializeProfile/JsSetSerializedProfile). Unlike the file based storage above
+    // this is available in all builds, so the profile of functions that have executed is collected from the function
+    // bodies directly rather than from the debug-only saving map.
+    //
+    static uint GetProfileBufferEngineVersion()
+    {
+        return (CHAKRA_CORE_MAJOR_VERSION << 16) | (CHAKRA_CORE_MINOR_VERSION << 8) | CHAKRA_CORE_PATCH_VERSION;
+    }
+
+    template <typename T>
+    bool
+    SourceDynamicProfileManager::SerializeExecutedFunctions(T * writer, BVFixed * executedFunctions, uint profileCount, SourceContextInfo* info, ScriptContext* scriptContext)
+    {
+        size_t bvSize = BVFixed::GetAllocSize(executedFunctions->Length());
+        if (!writer->Write(PROFILE_BUFFER_MAGIC)
+            || !writer->Write(PROFILE_BUFFER_VERSION)
+            || !writer->Write(GetProfileBufferEngineVersion())
+            || !writer->WriteArray((char *)executedFunctions, bvSize)
+            || !writer->Write(profileCount))
+        {
+            return false;
+        }
+
+        bool succeeded = true;
+        scriptContext->MapFunction([&](FunctionBody * functionBody)
+        {
+            if (succeeded && functionBody->GetSourceContextInfo() == info && functionBody->HasExecutionDynamicProfileInfo())
+            {
+                succeeded = functionBody->GetAnyDynamicProfileInfo()->Serialize(writer, functionBody);
+            }
+        });
+        return succeeded;
+    }
+
+    //
+    // Saves the profile of all the executed functions of the source into the buffer and returns the bytes written.
+    // If the buffer is null, returns the size of the buffer required.
+    //
+    uint SourceDynamicProfileManager::SaveToBuffer(SourceContextInfo* info, ScriptContext* scriptContext, __out_bcount_opt(bufferSize) byte* buffer, uint bufferSize)
+    {
+        Assert(info != nullptr && !info->IsDynamic());
+
+        // The startup function bit vector has to cover every function id we save a profile for
+        SourceDynamicProfileManager * manager = info->sourceDynamicProfileManager;
+        uint functionCount = info->nextLocalFunctionId;
+        if (manager != nullptr)
+        {
+            functionCount = max(functionCount, manager->GetStartupFunctionsLength());
+            if (manager->cachedStartupFunctions != nullptr)
+            {
+                functionCount = max(functionCount, manager->cachedStartupFunctions->Length());
+            }
+        }
+
+        // Deserialize considers more functions than this corrupt
+        if (functionCount == 0 || functionCount > MAX_FUNCTION_COUNT)
+        {
+            return 0;
+        }
+
+        BVFixed * executedFunctions = BVFixed::New(functionCount, scriptContext->GetRecycler());
+        if (manager != nullptr)
+        {
+            // Keep functions marked as executed if they were loaded to be so, same as the file based storage
+            if (manager->startupFunctions != nullptr)
+            {
+                executedFunctions->Copy(manager->startupFunctions);
+            }
+            if (manager->cachedStartupFunctions != nullptr)
+            {
+                for (BVIndex i = 0; i < manager->cachedStartupFunctions->Length(); i++)
+                {
+                    if (manager->cachedStartupFunctions->Test(i))
+                    {
+                        executedFunctions->Set(i);
+                    }
+                }
+            }
+        }
+
+        uint profileCount = 0;
+        scriptContext->MapFunction([&](FunctionBody * functionBody)
+        {
+            if (functionBody->GetSourceContextInfo() == info && functionBody->HasExecutionDynamicProfileInfo())
+            {
+                profileCount++;
+            }
+        });
+
+        BufferSizeCounter counter;
+        if (!SerializeExecutedFunctions(&counter, executedFunctions, profileCount, info, scriptContext)
+            || counter.GetByteCount() > UINT_MAX)
+        {
+            return 0;
+        }
+
+        if (buffer == nullptr)
+        {
+            return static_cast<uint>(counter.GetByteCount());
+        }
+
+        if (bufferSize < counter.GetByteCount())
+        {
+            return 0;
+        }
+
+        BufferWriter writer((char *)buffer, bufferSize);
+        if (!SerializeExecutedFunctions(&writer, executedFunctions, profileCount, info, scriptContext))
+        {
+            Assert(false);
+            return 0;
+        }
+
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile saved to buffer. Function count: %d Profile count: %d Bytes: %d\n"),
+            functionCount, profileCount, counter.GetByteCount());
+        return static_cast<uint>(counter.GetByteCount());
+    }
+
+    //
+    // Loads a profile saved by SaveToBuffer. Returns nullptr if the buffer was saved by a different engine version.
+    //
+    SourceDynamicProfileManager *
+    SourceDynamicProfileManager::LoadFromBuffer(__in_bcount(bufferSize) byte const* buffer, uint bufferSize, Recycler* recycler)
+    {
+        if (bufferSize < sizeof(uint) * 4)
+        {
+            return nullptr;
+        }
+
+        BufferReader reader((char const *)buffer, bufferSize);
+        uint magic = 0;
+        uint version = 0;
+        uint engineVersion = 0;
+        if (!reader.Peek(&magic) || magic != PROFILE_BUFFER_MAGIC
+            || !reader.Read(&magic)
+            || !reader.Read(&version) || version != PROFILE_BUFFER_VERSION
+            || !reader.Read(&engineVersion) || engineVersion != GetProfileBufferEngineVersion())
+        {
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load from buffer failed. Version mismatch\n"));
+            return nullptr;
+        }
+
+        return SourceDynamicProfileManager::Deserialize(&reader, recycler);
+    }
 };
 #endif
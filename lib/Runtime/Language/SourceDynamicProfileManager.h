@@ -44,6 +44,8 @@ namespace Js
         bool LoadFromProfileCache(SimpleDataCacheWrapper* dataCacheWrapper, LPCWSTR url);
         SimpleDataCacheWrapper* GetProfileCache() { return dataCacheWrapper; }
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
+        static uint SaveToBuffer(SourceContextInfo* info, ScriptContext* scriptContext, __out_bcount_opt(bufferSize) byte* buffer, uint bufferSize);
+        static SourceDynamicProfileManager * LoadFromBuffer(__in_bcount(bufferSize) byte const* buffer, uint bufferSize, Recycler* recycler);
 #ifdef DYNAMIC_PROFILE_STORAGE
         void ClearSavingData();
 #endif
@@ -62,10 +64,12 @@ namespace Js
         void SaveToDynamicProfileStorage(char16 const * url);
         void AddSavingItem(LocalFunctionId functionId, DynamicProfileInfo *info);
         template <typename T>
-        static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
-        template <typename T>
         bool Serialize(T * writer);
 #endif
+        template <typename T>
+        static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
+        template <typename T>
+        static bool SerializeExecutedFunctions(T * writer, BVFixed * executedFunctions, uint profileCount, SourceContextInfo* info, ScriptContext* scriptContext);
         uint SaveToProfileCache();
         bool ShouldSaveToProfileCache(SourceContextInfo* info) const;
 
@@ -80,6 +84,8 @@ namespace Js
         Field(DynamicProfileInfoMapType) dynamicProfileInfoMap;
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
+        static const uint PROFILE_BUFFER_MAGIC = 0x46504443; // 'CDPF'
+        static const uint PROFILE_BUFFER_VERSION = 1;        // Bump when the layout of the saved profile changes
     };
 };
 #endif  // ENABLE_PROFILE_INFO
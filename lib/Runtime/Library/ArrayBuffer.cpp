@@ -6,6 +6,73 @@
 
 namespace Js
 {
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+    uintptr_t volatile VirtualArrayBufferReservations::entries[VirtualArrayBufferReservations::MaxReservations];
+    LONG volatile VirtualArrayBufferReservations::entryCount = 0;
+
+    bool VirtualArrayBufferReservations::Register(void * address, size_t reservationSize)
+    {
+        Assert(((uintptr_t)address & WasmReservationBit) == 0);
+        Assert(reservationSize == MAX_ASMJS_ARRAYBUFFER_LENGTH || reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH);
+        uintptr_t entry = (uintptr_t)address | (reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH ? WasmReservationBit : 0);
+
+        // Claim a free slot; the signal handler never sees a partially written entry
+        for (LONG i = 0; i < MaxReservations; i++)
+        {
+            if (InterlockedCompareExchangePointer((PVOID volatile *)&entries[i], (PVOID)entry, nullptr) == nullptr)
+            {
+                LONG count = entryCount;
+                while (count <= i)
+                {
+                    LONG previous = InterlockedCompareExchange(&entryCount, i + 1, count);
+                    if (previous == count)
+                    {
+                        break;
+                    }
+                    count = previous;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void VirtualArrayBufferReservations::Unregister(void * address)
+    {
+        // Removed before the memory is released, so a later reservation at the same address isn't mistaken for this one
+        LONG count = entryCount;
+        for (LONG i = 0; i < count; i++)
+        {
+            if ((entries[i] & ~WasmReservationBit) == (uintptr_t)address)
+            {
+                InterlockedExchangePointer((PVOID volatile *)&entries[i], nullptr);
+                return;
+            }
+        }
+        Assert(UNREACHED);
+    }
+
+    size_t VirtualArrayBufferReservations::Find(uintptr_t address)
+    {
+        LONG count = entryCount;
+        for (LONG i = 0; i < count; i++)
+        {
+            uintptr_t entry = entries[i];
+            if (entry == 0)
+            {
+                continue;
+            }
+            uintptr_t base = entry & ~WasmReservationBit;
+            size_t reservationSize = (entry & WasmReservationBit) ? MAX_WASM__ARRAYBUFFER_LENGTH : MAX_ASMJS_ARRAYBUFFER_LENGTH;
+            if (address >= base && address - base < reservationSize)
+            {
+                return reservationSize;
+            }
+        }
+        return 0;
+    }
+#endif
+
     bool ArrayBufferBase::Is(Var value)
     {
         return ArrayBuffer::Is(value) || SharedArrayBuffer::Is(value);
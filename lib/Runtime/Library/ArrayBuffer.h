@@ -12,6 +12,30 @@ namespace Js
     class ArrayBuffer;
     class SharedArrayBuffer;
 
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+    // Table of the guarded reservations made by ArrayBufferBase::AllocWrapper. Without SEH, out of bounds accesses
+    // are recovered in the SIGSEGV handler (see JavascriptFunction::HardwareExceptionHandler), which can't take locks
+    // or query the recycler, so Find only reads the table.
+    class VirtualArrayBufferReservations
+    {
+    public:
+        static bool Register(void * address, size_t reservationSize);
+        static void Unregister(void * address);
+        // Returns the size of the reservation that contains the address, or 0 if there is none
+        static size_t Find(uintptr_t address);
+
+    private:
+        // Reservations are 4GB or 8GB, so the address space can't hold many more than this
+        static const LONG MaxReservations = 4096;
+        // Reservations are aligned to the allocation granularity, so the low bit of an entry records an 8GB one
+        static const uintptr_t WasmReservationBit = 1;
+
+        static uintptr_t volatile entries[MaxReservations];
+        // Only grows, so Find never has to scan past the last slot ever used
+        static LONG volatile entryCount;
+    };
+#endif
+
     class ArrayBufferBase : public DynamicObject
     {
     protected:
@@ -30,7 +54,7 @@ namespace Js
             Js::Throw::FatalInternalError();
         }
 #endif
-#ifdef _WIN32
+#if defined(_WIN32) || ENABLE_FAST_ARRAYBUFFER
         static void* __cdecl AllocWrapper(DECLSPEC_GUARD_OVERFLOW size_t length, size_t MaxVirtualSize)
         {
             LPVOID address = VirtualAlloc(nullptr, MaxVirtualSize, MEM_RESERVE, PAGE_NOACCESS);
@@ -39,6 +63,13 @@ namespace Js
             {
                 return nullptr;
             }
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+            if (!VirtualArrayBufferReservations::Register(address, MaxVirtualSize))
+            {
+                VirtualFree(address, 0, MEM_RELEASE);
+                return nullptr;
+            }
+#endif
 
             if (length == 0)
             {
@@ -48,7 +79,7 @@ namespace Js
             LPVOID arrayAddress = VirtualAlloc(address, length, MEM_COMMIT, PAGE_READWRITE);
             if (!arrayAddress)
             {
-                VirtualFree(address, 0, MEM_RELEASE);
+                FreeMemAlloc(address);
                 return nullptr;
             }
             return arrayAddress;
@@ -61,6 +92,9 @@ namespace Js
 
         static void FreeMemAlloc(Var ptr)
         {
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+            VirtualArrayBufferReservations::Unregister(ptr);
+#endif
             BOOL fSuccess = VirtualFree((LPVOID)ptr, 0, MEM_RELEASE);
             Assert(fSuccess);
         }
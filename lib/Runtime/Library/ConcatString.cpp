@@ -104,6 +104,12 @@ namespace Js
             Js::JavascriptError::ThrowOutOfMemoryError(scriptContext);
         }
 
+        // ASCII is both valid UTF-8 and Latin-1, so the contents can be kept as they are until a wide buffer is needed
+        if (charCount >= OneByteString::MinCharCount && !PHASE_OFF1(Js::OneByteStringPhase) && OneByteString::IsAscii(cString, charCount))
+        {
+            return OneByteString::NewCopyBuffer(cString, charCount, library);
+        }
+
         Recycler * recycler = library->GetRecycler();
         char16* destString = RecyclerNewArrayLeaf(recycler, WCHAR, charCount + 1);
         if (destString == nullptr)
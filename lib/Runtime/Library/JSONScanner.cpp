@@ -5,10 +5,87 @@
 #include "RuntimeLibraryPch.h"
 #include "JSONScanner.h"
 
+#if defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
 using namespace Js;
 
 namespace JSON
 {
+    // Large payloads are mostly made of string contents and, when pretty printed, whitespace. Both are skipped in bulk
+    // here, 8 characters at a time on x64, instead of going through the scanner's per-character switch.
+#if defined(_M_X64)
+    static inline uint FirstStopCharIndex(uint stopMask)
+    {
+        Assert(stopMask != 0);
+        DWORD index;
+        _BitScanForward(&index, stopMask);
+        // movemask yields two bits per 16-bit character
+        return index / 2;
+    }
+#endif
+
+    // Returns the first character in [current, end) that is a quote, a backslash or a control character, or end
+    static const char16* SkipPlainStringChars(const char16* current, const char16* end)
+    {
+#if defined(_M_X64)
+        const __m128i quote = _mm_set1_epi16('"');
+        const __m128i backslash = _mm_set1_epi16('\\');
+        const __m128i maxControlChar = _mm_set1_epi16(0x1F);
+        while (end - current >= 8)
+        {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current));
+
+            // Saturating subtraction leaves zero exactly for characters <= 0x1F
+            __m128i isControl = _mm_cmpeq_epi16(_mm_subs_epu16(chars, maxControlChar), _mm_setzero_si128());
+            __m128i isStop = _mm_or_si128(isControl, _mm_or_si128(_mm_cmpeq_epi16(chars, quote), _mm_cmpeq_epi16(chars, backslash)));
+
+            uint stopMask = (uint)_mm_movemask_epi8(isStop);
+            if (stopMask != 0)
+            {
+                return current + FirstStopCharIndex(stopMask);
+            }
+            current += 8;
+        }
+#endif
+
+        while (current < end && *current != '"' && *current != '\\' && *current > 0x1F)
+        {
+            current++;
+        }
+        return current;
+    }
+
+    // Returns the first character in [current, end) that is not JSON whitespace, or end
+    static const char16* SkipWhitespace(const char16* current, const char16* end)
+    {
+#if defined(_M_X64)
+        while (end - current >= 8)
+        {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(current));
+            __m128i isSpace = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi16(chars, _mm_set1_epi16(' ')), _mm_cmpeq_epi16(chars, _mm_set1_epi16('\t'))),
+                _mm_or_si128(_mm_cmpeq_epi16(chars, _mm_set1_epi16('\r')), _mm_cmpeq_epi16(chars, _mm_set1_epi16('\n'))));
+
+            uint stopMask = ~(uint)_mm_movemask_epi8(isSpace) & 0xFFFF;
+            if (stopMask != 0)
+            {
+                return current + FirstStopCharIndex(stopMask);
+            }
+            current += 8;
+        }
+#endif
+
+        while (current < end && (*current == ' ' || *current == '\t' || *current == '\r' || *current == '\n'))
+        {
+            current++;
+        }
+        return current;
+    }
+
     // -------- Scanner implementation ------------//
     JSONScanner::JSONScanner()
         : inputText(0), inputLen(0), pToken(0), stringBuffer(0), allocator(0), allocatorObject(0),
@@ -57,6 +134,7 @@ namespace JSON
             case '\n':
             case ' ':
                 //WS - keep looping
+                currentChar = SkipWhitespace(currentChar, inputText + inputLen);
                 break;
 
             case '"':
@@ -233,6 +311,14 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            const char16* plainEnd = SkipPlainStringChars(currentChar, inputText + inputLen);
+            bulkLength += (uint)(plainEnd - currentChar);
+            currentChar = plainEnd;
+            if (currentChar >= inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
@@ -6631,10 +6631,278 @@ using namespace Js;
         return newObj;
     }
 
+    // Comparers of the form (a, b) => a - b and (a, b) => b - a are common enough that sort recognizes them by their
+    // source, and compares numbers directly instead of calling back into script for every comparison.
+    enum class KnownSortComparer : uint8
+    {
+        None,
+        NumericAscending,
+        NumericDescending
+    };
+
+    // Reads a compacted copy of a short function source: whitespace is dropped except for a single space between
+    // two identifier characters, and anything other than identifier characters and the punctuators used by the
+    // comparers we recognize (comments, strings, operators, non-ASCII characters) fails the match.
+    class KnownSortComparerMatcher
+    {
+    private:
+        static const size_t MaxSourceLength = 64;
+
+        char text[MaxSourceLength];
+        size_t length;
+        size_t current;
+
+        static bool IsIdentifierChar(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$';
+        }
+
+        static bool IsPunctuator(char c)
+        {
+            switch (c)
+            {
+            case '(': case ')': case ',': case '=': case '>': case '{': case '}': case ';': case '-':
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        bool Match(const char* token)
+        {
+            const size_t tokenLength = strlen(token);
+            if (length - current < tokenLength || memcmp(text + current, token, tokenLength) != 0)
+            {
+                return false;
+            }
+            current += tokenLength;
+            return true;
+        }
+
+        bool MatchIdentifier(size_t* start, size_t* identifierLength)
+        {
+            if (current == length || !IsIdentifierChar(text[current]) || (text[current] >= '0' && text[current] <= '9'))
+            {
+                return false;
+            }
+            *start = current;
+            while (current < length && IsIdentifierChar(text[current]))
+            {
+                current++;
+            }
+            *identifierLength = current - *start;
+            return true;
+        }
+
+        bool IsSameIdentifier(size_t start1, size_t length1, size_t start2, size_t length2) const
+        {
+            return length1 == length2 && memcmp(text + start1, text + start2, length1) == 0;
+        }
+
+        // Matches "x-y" where x and y are the two parameters, in either order
+        KnownSortComparer MatchDifference(size_t param1, size_t param1Length, size_t param2, size_t param2Length)
+        {
+            size_t left, leftLength, right, rightLength;
+            if (!MatchIdentifier(&left, &leftLength) || !Match("-") || !MatchIdentifier(&right, &rightLength))
+            {
+                return KnownSortComparer::None;
+            }
+            if (IsSameIdentifier(left, leftLength, param1, param1Length) && IsSameIdentifier(right, rightLength, param2, param2Length))
+            {
+                return KnownSortComparer::NumericAscending;
+            }
+            if (IsSameIdentifier(left, leftLength, param2, param2Length) && IsSameIdentifier(right, rightLength, param1, param1Length))
+            {
+                return KnownSortComparer::NumericDescending;
+            }
+            return KnownSortComparer::None;
+        }
+
+    public:
+        KnownSortComparerMatcher() : length(0), current(0) { }
+
+        bool SetSource(LPCUTF8 source, size_t sourceLength)
+        {
+            bool pendingSpace = false;
+            for (size_t i = 0; i < sourceLength; i++)
+            {
+                const char c = (char)source[i];
+                if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+                {
+                    pendingSpace = length != 0 && IsIdentifierChar(text[length - 1]);
+                    continue;
+                }
+                if (!IsIdentifierChar(c) && !IsPunctuator(c))
+                {
+                    return false;
+                }
+                if (pendingSpace && IsIdentifierChar(c))
+                {
+                    if (length == MaxSourceLength)
+                    {
+                        return false;
+                    }
+                    text[length++] = ' ';
+                }
+                pendingSpace = false;
+                if (length == MaxSourceLength)
+                {
+                    return false;
+                }
+                text[length++] = c;
+            }
+            return true;
+        }
+
+        // Matches "(a,b)=>a-b", "(a,b)=>{return a-b}" and "function f(a,b){return a-b}", with optional
+        // function name and semicolon, and the parameters in either order in the difference
+        KnownSortComparer Match()
+        {
+            size_t name, nameLength, param1, param1Length, param2, param2Length;
+            const bool isFunction = Match("function");
+            if (isFunction && Match(" ") && !MatchIdentifier(&name, &nameLength))
+            {
+                return KnownSortComparer::None;
+            }
+            if (!Match("(") || !MatchIdentifier(&param1, &param1Length) || !Match(",") ||
+                !MatchIdentifier(&param2, &param2Length) || !Match(")") ||
+                IsSameIdentifier(param1, param1Length, param2, param2Length))
+            {
+                return KnownSortComparer::None;
+            }
+
+            if (!isFunction && !Match("=>"))
+            {
+                return KnownSortComparer::None;
+            }
+
+            KnownSortComparer comparer;
+            if (Match("{"))
+            {
+                if (!Match("return "))
+                {
+                    return KnownSortComparer::None;
+                }
+                comparer = MatchDifference(param1, param1Length, param2, param2Length);
+                Match(";");
+                if (!Match("}"))
+                {
+                    return KnownSortComparer::None;
+                }
+            }
+            else if (!isFunction)
+            {
+                comparer = MatchDifference(param1, param1Length, param2, param2Length);
+            }
+            else
+            {
+                return KnownSortComparer::None;
+            }
+            return current == length ? comparer : KnownSortComparer::None;
+        }
+    };
+
+    static KnownSortComparer GetKnownSortComparer(RecyclableObject* compFn)
+    {
+        if (compFn == nullptr || !ScriptFunction::Is(compFn))
+        {
+            return KnownSortComparer::None;
+        }
+
+        // Calls into the comparer have to stay observable to the debugger
+        if (compFn->GetScriptContext()->IsScriptContextInDebugMode())
+        {
+            return KnownSortComparer::None;
+        }
+
+        ParseableFunctionInfo* functionInfo = ScriptFunction::UnsafeFromVar(compFn)->GetFunctionProxy()->EnsureDeserialized();
+        Utf8SourceInfo* sourceInfo = functionInfo->GetUtf8SourceInfo();
+        if (sourceInfo == nullptr || sourceInfo->GetIsLibraryCode()
+#ifdef ENABLE_WASM
+            || functionInfo->IsWasmFunction()
+#endif
+            )
+        {
+            return KnownSortComparer::None;
+        }
+
+        // Same range as Function.prototype.toString
+        Assert(functionInfo->StartOffset() >= functionInfo->PrintableStartOffset());
+        const size_t sourceLength = functionInfo->LengthInBytes() + (functionInfo->StartOffset() - functionInfo->PrintableStartOffset());
+        KnownSortComparerMatcher matcher;
+        if (!matcher.SetSource(functionInfo->GetToStringSource(_u("GetKnownSortComparer")), sourceLength))
+        {
+            return KnownSortComparer::None;
+        }
+        return matcher.Match();
+    }
+
+    static int CompareDifference(double left, double right)
+    {
+        // Same result as calling the comparer, including 0 for NaN
+        const double difference = left - right;
+        return difference < 0 ? -1 : (difference > 0 ? 1 : 0);
+    }
+
+    static bool TryGetNumber(Var value, double* number)
+    {
+        if (TaggedInt::Is(value))
+        {
+            *number = TaggedInt::ToDouble(value);
+            return true;
+        }
+        if (JavascriptNumber::Is_NoTaggedIntCheck(value))
+        {
+            *number = JavascriptNumber::GetValue(value);
+            return true;
+        }
+        return false;
+    }
+
+    // Compares two int32s in the order of their decimal strings, as the default comparer does, without creating the strings
+    static int CompareInt32AsStrings(int32 left, int32 right)
+    {
+        if (left == right)
+        {
+            return 0;
+        }
+
+        char leftBuffer[12];
+        char rightBuffer[12];
+        auto toDecimal = [](int32 value, char (&buffer)[12], size_t* length) -> const char*
+        {
+            char* end = buffer + _countof(buffer);
+            char* digits = end;
+            uint32 magnitude = value < 0 ? 0u - (uint32)value : (uint32)value;
+            do
+            {
+                *--digits = (char)('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (value < 0)
+            {
+                *--digits = '-';
+            }
+            *length = end - digits;
+            return digits;
+        };
+
+        size_t leftLength, rightLength;
+        const char* leftDigits = toDecimal(left, leftBuffer, &leftLength);
+        const char* rightDigits = toDecimal(right, rightBuffer, &rightLength);
+        const int result = memcmp(leftDigits, rightDigits, min(leftLength, rightLength));
+        if (result != 0)
+        {
+            return result;
+        }
+        return leftLength < rightLength ? -1 : 1;
+    }
+
     struct CompareVarsInfo
     {
         ScriptContext* scriptContext;
         RecyclableObject* compFn;
+        KnownSortComparer knownComparer;
     };
 
     int __cdecl compareVars(void* cvInfoV, const void* aRef, const void* bRef)
@@ -6648,6 +6916,12 @@ using namespace Js;
 
         if (compFn != nullptr)
         {
+            double left, right;
+            if (cvInfo->knownComparer != KnownSortComparer::None && TryGetNumber(*(Var*)aRef, &left) && TryGetNumber(*(Var*)bRef, &right))
+            {
+                return cvInfo->knownComparer == KnownSortComparer::NumericAscending ? CompareDifference(left, right) : CompareDifference(right, left);
+            }
+
             ScriptContext* scriptContext = compFn->GetScriptContext();
             ThreadContext* threadContext = scriptContext->GetThreadContext();
             // The correct flag value is CallFlags_Value but we pass CallFlags_None in compat modes
@@ -6701,41 +6975,16 @@ using namespace Js;
         }
     }
 
-    static void hybridSort(__inout_ecount(length) Field(Var) *elements, uint32 length, CompareVarsInfo* compareInfo)
+    // Sorts with a stable merge sort, as required since ES2019, which also takes advantage of runs that are already in order
+    static void stableSort(__inout_ecount(length) Field(Var) *elements, uint32 length, CompareVarsInfo* compareInfo, Recycler* recycler)
     {
-        // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
-        // for arrays of more than 512 elements.
-        if (length > 512)
-        {
-            qsort_s(elements, length, compareVars, compareInfo);
-            return;
-        }
+        auto comparer = [compareInfo](const Field(Var)& a, const Field(Var)& b) { return compareVars(compareInfo, &a, &b); };
+        typedef JsUtil::TimSort<Field(Var), decltype(comparer)> VarTimSort;
 
-        for (int i = 1; i < (int)length; i++)
-        {
-            if (compareVars(compareInfo, elements + i, elements + i - 1) < 0) {
-                // binary search for the left-most element greater than value:
-                int first = 0;
-                int last = i - 1;
-                while (first <= last)
-                {
-                    int middle = (first + last) / 2;
-                    if (compareVars(compareInfo, elements + i, elements + middle) < 0)
-                    {
-                        last = middle - 1;
-                    }
-                    else
-                    {
-                        first = middle + 1;
-                    }
-                }
-
-                // insert value right before first:
-                Var value = elements[i];
-                MoveArray(elements + first + 1, elements + first, (i - first));
-                elements[first] = value;
-            }
-        }
+        // Merges move elements to the temporary buffer, which must keep them alive
+        const uint32 tempLength = VarTimSort::GetTempBufferLength(length);
+        Field(Var)* temp = tempLength != 0 ? RecyclerNewArrayZ(recycler, Field(Var), tempLength) : nullptr;
+        VarTimSort::Sort(elements, length, temp, comparer);
     }
 
     void JavascriptArray::Sort(RecyclableObject* compFn)
@@ -6756,6 +7005,7 @@ using namespace Js;
         CompareVarsInfo cvInfo;
         cvInfo.scriptContext = scriptContext;
         cvInfo.compFn = compFn;
+        cvInfo.knownComparer = GetKnownSortComparer(compFn);
 
         Assert(head != nullptr);
 
@@ -6791,7 +7041,7 @@ using namespace Js;
 #ifdef VALIDATE_ARRAY
                     ValidateSegment(startSeg);
 #endif
-                    JS_REENTRANT(jsReentLock, hybridSort(startSeg->elements, startSeg->length, &cvInfo));
+                    JS_REENTRANT(jsReentLock, stableSort(startSeg->elements, startSeg->length, &cvInfo, recycler));
                     startSeg->CheckLengthvsSize();
                 }
                 else
@@ -6824,7 +7074,7 @@ using namespace Js;
 
                 if (compFn != nullptr)
                 {
-                    JS_REENTRANT(jsReentLock, hybridSort(allElements->elements, allElements->length, &cvInfo));
+                    JS_REENTRANT(jsReentLock, stableSort(allElements->elements, allElements->length, &cvInfo, recycler));
                 }
                 else
                 {
@@ -6990,8 +7240,96 @@ using namespace Js;
 
     void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
     {
-        // Note: use write barrier policy of Field(Var)
-        qsort_s<Element, Field(Var)>(elements, right - left + 1, CompareElements, this);
+        auto comparer = [](const Element& a, const Element& b) { return CompareElements(nullptr, &a, &b); };
+        typedef JsUtil::TimSort<Element, decltype(comparer)> ElementTimSort;
+
+        const uint32 length = right - left + 1;
+        const uint32 tempLength = ElementTimSort::GetTempBufferLength(length);
+        Element* temp = tempLength != 0 ? RecyclerNewArrayZ(this->GetScriptContext()->GetRecycler(), Element, tempLength) : nullptr;
+        ElementTimSort::Sort(elements + left, length, temp, comparer);
+    }
+
+    template <typename T, typename TComparer>
+    void JavascriptArray::SortNativeHead(const TComparer& comparer)
+    {
+        SparseArraySegment<T>* seg = SparseArraySegment<T>::From(this->head);
+        Assert(seg->left == 0 && seg->next == nullptr);
+
+        // Missing values go to the end, outside of the segment, as in Sort
+        uint32 count = 0;
+        for (uint32 i = 0; i < seg->length; i++)
+        {
+            if (!SparseArraySegment<T>::IsMissingItem(&seg->elements[i]))
+            {
+                seg->elements[count++] = seg->elements[i];
+            }
+        }
+        if (count != seg->length)
+        {
+            for (uint32 i = count; i < seg->length; i++)
+            {
+                seg->elements[i] = SparseArraySegment<T>::GetMissingItem();
+            }
+            seg->length = count;
+        }
+
+        typedef JsUtil::TimSort<T, TComparer> NativeTimSort;
+        const uint32 tempLength = NativeTimSort::GetTempBufferLength(count);
+        T* temp = tempLength != 0 ? RecyclerNewArrayLeaf(this->GetScriptContext()->GetRecycler(), T, tempLength) : nullptr;
+        NativeTimSort::Sort(seg->elements, count, temp, comparer);
+
+        SetHasNoMissingValues();
+        this->InvalidateLastUsedSegment();
+        this->ClearSegmentMap();
+    }
+
+    // Sorts a native array without converting it to a var array, when that can be done without calling into
+    // script: ints with the default comparer, whose string order is computed directly, and ints or floats
+    // with a known numeric comparer.
+    bool JavascriptArray::TrySortNative(RecyclableObject* compFn)
+    {
+        if (head->next != nullptr || head->left != 0 || CONFIG_FLAG(StrongArraySort))
+        {
+            return false;
+        }
+
+        const KnownSortComparer knownComparer = GetKnownSortComparer(compFn);
+        if (compFn != nullptr && knownComparer == KnownSortComparer::None)
+        {
+            return false;
+        }
+
+        if (JavascriptNativeIntArray::Is(this))
+        {
+            if (compFn == nullptr)
+            {
+                SortNativeHead<int32>([](int32 a, int32 b) { return CompareInt32AsStrings(a, b); });
+            }
+            else if (knownComparer == KnownSortComparer::NumericAscending)
+            {
+                SortNativeHead<int32>([](int32 a, int32 b) { return (a > b) - (a < b); });
+            }
+            else
+            {
+                SortNativeHead<int32>([](int32 a, int32 b) { return (b > a) - (b < a); });
+            }
+            return true;
+        }
+
+        if (JavascriptNativeFloatArray::Is(this) && compFn != nullptr)
+        {
+            if (knownComparer == KnownSortComparer::NumericAscending)
+            {
+                SortNativeHead<double>([](double a, double b) { return CompareDifference(a, b); });
+            }
+            else
+            {
+                SortNativeHead<double>([](double a, double b) { return CompareDifference(b, a); });
+            }
+            return true;
+        }
+
+        return false;
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -7056,8 +7394,11 @@ using namespace Js;
                 Js::Throw::FatalInternalError();
             }
 
-            EnsureNonNativeArray(arr);
-            JS_REENTRANT(jsReentLock, arr->Sort(compFn));
+            if (!arr->TrySortNative(compFn))
+            {
+                EnsureNonNativeArray(arr);
+                JS_REENTRANT(jsReentLock, arr->Sort(compFn));
+            }
         }
         else
         {
@@ -168,6 +168,7 @@ namespace Js
         template<typename T> void SetArrayLiteralItem(uint32 index, T value);
 
         void Sort(RecyclableObject* compFn);
+        bool TrySortNative(RecyclableObject* compFn);
 
         template<typename NativeArrayType, typename T> NativeArrayType * ConvertToNativeArrayInPlace(JavascriptArray *varArray);
 
@@ -636,6 +637,7 @@ namespace Js
 
         static int __cdecl CompareElements(void* context, const void* elem1, const void* elem2);
         void SortElements(Element* elements, uint32 left, uint32 right);
+        template <typename T, typename TComparer> void SortNativeHead(const TComparer& comparer);
 
         template <typename Fn>
         static void ForEachOwnMissingArrayIndexOfObject(JavascriptArray *baseArr, JavascriptArray *destArray, RecyclableObject* obj, uint32 startIndex, uint32 limitIndex, uint32 destIndex, Fn fn);
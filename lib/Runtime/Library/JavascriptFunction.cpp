@@ -707,9 +707,8 @@ using namespace Js;
 #endif
 
 #ifdef DISABLE_SEH
-        // xplat: JavascriptArrayBuffer::AllocWrapper is disabled on cross-platform
-        // (IsValidVirtualBufferLength always returns false).
-        // SEH and ResumeForOutOfBoundsArrayRefs are not needed.
+        // xplat: there is no SEH. Where ENABLE_FAST_ARRAYBUFFER is enabled, out of bounds accesses to
+        // guarded array buffers are recovered from the PAL signal handler instead (see HardwareExceptionHandler).
         ret = JavascriptFunction::CallRootFunctionInternal(obj, args, scriptContext, inScript);
 #else
         if (scriptContext->GetThreadContext()->GetAbnormalExceptionCode() != 0)
@@ -2295,6 +2294,8 @@ void __cdecl _alloca_probe_16()
     }
 
 #if ENABLE_FAST_ARRAYBUFFER
+    bool SkipOutOfBoundsArrayRef(PEXCEPTION_POINTERS exceptionInfo);
+
     bool ResumeForOutOfBoundsArrayRefs(int exceptionCode, ExceptionFilterHelper& helper)
     {
         if (exceptionCode != STATUS_ACCESS_VIOLATION)
@@ -2388,7 +2389,13 @@ void __cdecl _alloca_probe_16()
             }
         }
 
-        PEXCEPTION_POINTERS exceptionInfo = helper.GetExceptionInfo();
+        return SkipOutOfBoundsArrayRef(helper.GetExceptionInfo());
+    }
+
+    // Makes an out of bounds load produce 0 (NaN for floats), and an out of bounds store do nothing, and
+    // resumes after the faulting instruction
+    bool SkipOutOfBoundsArrayRef(PEXCEPTION_POINTERS exceptionInfo)
+    {
         BYTE* pc = (BYTE*)exceptionInfo->ExceptionRecord->ExceptionAddress;
         ArrayAccessDecoder::InstructionData instrData = ArrayAccessDecoder::CheckValidInstr(pc, exceptionInfo);
         // Check If the instruction is valid
@@ -2465,6 +2472,62 @@ void __cdecl _alloca_probe_16()
         return EXCEPTION_CONTINUE_SEARCH;
     }
 
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+    // Without SEH we can't throw from the signal handler. Instead, the faulting instruction is made to call this, so
+    // the error is thrown from the wasm function's frame once the handler returns. Outside of the signal handler, the
+    // function object can be looked up the same way ExceptionFilterHelper does.
+    static void __declspec(noreturn) ThrowWasmOutOfBoundsAccess(Var* addressOfFuncObj)
+    {
+        ThreadContext* threadContext = ThreadContext::GetContextForCurrentThread();
+        ScriptContext* scriptContext = threadContext->GetScriptEntryExit()->scriptContext;
+
+        RecyclerHeapObjectInfo heapObject;
+        if (*addressOfFuncObj != nullptr
+            && threadContext->GetRecycler()->FindHeapObject(*addressOfFuncObj, FindHeapObjectFlags_NoFlags, heapObject)
+            && ScriptFunction::Is(*addressOfFuncObj))
+        {
+            scriptContext = ScriptFunction::FromVar(*addressOfFuncObj)->GetScriptContext();
+        }
+        JavascriptError::ThrowWebAssemblyRuntimeError(scriptContext, WASMERR_ArrayIndexOutOfRange);
+    }
+
+    BOOL PALAPI JavascriptFunction::HardwareExceptionHandler(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        // This runs in the SIGSEGV handler, on any faulting thread and possibly while that thread holds a lock, so it
+        // only uses async-signal-safe operations: no locks, allocations, recycler lookups or VirtualQuery. Unlike in
+        // ResumeForOutOfBoundsArrayRefs the function object isn't looked at. The runtime and the interpreter bound
+        // check every access, so a fault inside a registered guard reservation is only recovered from when it's
+        // raised by JIT'd code; anything else is a real crash. Wasm memories are the only 8GB reservations and JIT'd
+        // script isn't given virtual typed arrays over them (see TypedArray's constructor), so a fault in one of
+        // those is a wasm trap.
+        if (exceptionInfo->ExceptionRecord->ExceptionCode != STATUS_ACCESS_VIOLATION
+            || ThreadContext::GetContextForCurrentThread() == nullptr
+            || !JitCodeSegmentReservations::Contains((uintptr_t)exceptionInfo->ContextRecord->Rip))
+        {
+            return FALSE;
+        }
+
+        size_t reservationSize = VirtualArrayBufferReservations::Find(exceptionInfo->ExceptionRecord->ExceptionInformation[1]);
+        if (reservationSize == 0)
+        {
+            return FALSE;
+        }
+
+        if (reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH)
+        {
+            // Simulate a call to the throw helper from the faulting instruction (JIT'd code doesn't use the red zone)
+            CONTEXT* context = exceptionInfo->ContextRecord;
+            context->Rsp -= sizeof(DWORD64);
+            *(DWORD64*)context->Rsp = context->Rip;
+            context->Rip = (DWORD64)&ThrowWasmOutOfBoundsAccess;
+            context->Rdi = context->Rbp + 2 * sizeof(Var);
+            return TRUE;
+        }
+
+        return SkipOutOfBoundsArrayRef(exceptionInfo);
+    }
+#endif
+
 #if DBG
     void JavascriptFunction::VerifyEntryPoint()
     {
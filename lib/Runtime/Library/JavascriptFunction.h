@@ -228,6 +228,10 @@ namespace Js
         void VerifyEntryPoint();
 
         static bool IsBuiltinProperty(Var objectWithProperty, PropertyIds propertyId);
+#endif
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+        // Registered with the PAL to recover from out of bounds accesses to guarded array buffers
+        static BOOL PALAPI HardwareExceptionHandler(PEXCEPTION_POINTERS exceptionInfo);
 #endif
         private:
             static int CallRootEventFilter(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo);
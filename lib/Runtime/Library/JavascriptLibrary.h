@@ -34,6 +34,9 @@ namespace Js
     static const unsigned int EvalMRUSize = 15;
     typedef JsUtil::BaseDictionary<DWORD_PTR, SourceContextInfo *, Recycler, PowerOf2SizePolicy> SourceContextInfoMap;
     typedef JsUtil::BaseDictionary<uint, SourceContextInfo *, Recycler, PowerOf2SizePolicy> DynamicSourceContextInfoMap;
+#if ENABLE_PROFILE_INFO
+    typedef JsUtil::BaseDictionary<DWORD_PTR, SourceDynamicProfileManager *, Recycler, PowerOf2SizePolicy> HostProvidedProfileMap;
+#endif
 
     typedef JsUtil::BaseDictionary<EvalMapString, ScriptFunction*, RecyclerNonLeafAllocator, PrimeSizePolicy> SecondLevelEvalCache;
     typedef TwoLevelHashRecord<FastEvalMapString, ScriptFunction*, SecondLevelEvalCache, EvalMapString> EvalMapRecord;
@@ -92,6 +95,7 @@ namespace Js
         Field(EnumeratorCache*) assignCache;
         Field(EnumeratorCache*) stringifyCache;
 #if ENABLE_PROFILE_INFO
+        Field(HostProvidedProfileMap*) hostProvidedProfileMap; // profiles set by the host for sources that are not loaded yet
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(DynamicProfileInfoList*) profileInfoList;
 #endif
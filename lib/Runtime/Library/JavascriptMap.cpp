@@ -369,15 +369,15 @@ JavascriptMap::DeleteFromVarMap(Var value)
 {
     Assert(this->kind == (isComplex ? MapKind::ComplexVarMap : MapKind::SimpleVarMap));
 
-    MapDataNode * node = nullptr;
+    uint32 index = 0;
     if (isComplex
-        ? !this->u.complexVarMap->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarMap->TryGetValueAndRemove(value, &node))
+        ? !this->u.complexVarMap->TryGetValueAndRemove(value, &index)
+        : !this->u.simpleVarMap->TryGetValueAndRemove(value, &index))
     {
         return false;
     }
 
-    this->list.Remove(node);
+    this->list.Remove(index);
     return true;
 }
 
@@ -428,10 +428,10 @@ JavascriptMap::Get(Var key, Var* value)
     case MapKind::SimpleVarMap:
     {
         // First check if the key is in the map
-        MapDataNode* node = nullptr;
-        if (this->u.simpleVarMap->TryGetValue(key, &node))
+        uint32 index = 0;
+        if (this->u.simpleVarMap->TryGetValue(key, &index))
         {
-            *value = node->data.Value();
+            *value = this->list.Item(index).Value();
             return true;
         }
         // If the key isn't in the map, check if the canonical value is
@@ -442,21 +442,21 @@ JavascriptMap::Get(Var key, Var* value)
             return false;
         }
 
-        if (!this->u.simpleVarMap->TryGetValue(simpleVar, &node))
+        if (!this->u.simpleVarMap->TryGetValue(simpleVar, &index))
         {
             return false;
         }
-        *value = node->data.Value();
+        *value = this->list.Item(index).Value();
         return true;
     }
     case MapKind::ComplexVarMap:
     {
-        MapDataNode * node = nullptr;
-        if (!this->u.complexVarMap->TryGetValue(key, &node))
+        uint32 index = 0;
+        if (!this->u.complexVarMap->TryGetValue(key, &index))
         {
             return false;
         }
-        *value = node->data.Value();
+        *value = this->list.Item(index).Value();
         return true;
     }
     default:
@@ -514,13 +514,40 @@ JavascriptMap::PromoteToComplexVarMap()
     // TODO: we can use a more efficient Iterator, since we know there will be no side effects
     while (iter.Next())
     {
-        newMap->Add(iter.Current().Key(), iter.CurrentNode());
+        newMap->Add(iter.Current().Key(), iter.CurrentIndex());
     }
 
     this->kind = MapKind::ComplexVarMap;
     this->u.complexVarMap = newMap;
 }
 
+uint32
+JavascriptMap::AppendToList(Var key, Var value)
+{
+    MapDataKeyValuePair pair(key, value);
+    return this->list.Append(pair, this->GetRecycler(), [this](const MapDataKeyValuePair& movedPair, uint32 newIndex)
+    {
+        this->UpdateIndex(movedPair.Key(), newIndex);
+    });
+}
+
+void
+JavascriptMap::UpdateIndex(Var key, uint32 index)
+{
+    switch (this->kind)
+    {
+    case MapKind::SimpleVarMap:
+        this->u.simpleVarMap->Item(key, index);
+        return;
+    case MapKind::ComplexVarMap:
+        this->u.complexVarMap->Item(key, index);
+        return;
+    default:
+        // Entries only move when the list is full, which it can't be for an empty map
+        Assume(UNREACHED);
+    }
+}
+
 void
 JavascriptMap::SetOnEmptyMap(Var key, Var value)
 {
@@ -529,11 +556,10 @@ JavascriptMap::SetOnEmptyMap(Var key, Var value)
     if (simpleVar)
     {
         SimpleVarDataMap* newSimpleMap = RecyclerNew(this->GetRecycler(), SimpleVarDataMap, this->GetRecycler());
-        MapDataKeyValuePair simplePair(simpleVar, value);
 
-        MapDataNode* node = this->list.Append(simplePair, this->GetRecycler());
+        uint32 index = this->AppendToList(simpleVar, value);
 
-        newSimpleMap->Add(simpleVar, node);
+        newSimpleMap->Add(simpleVar, index);
 
         this->u.simpleVarMap = newSimpleMap;
         this->kind = MapKind::SimpleVarMap;
@@ -541,11 +567,10 @@ JavascriptMap::SetOnEmptyMap(Var key, Var value)
     }
 
     ComplexVarDataMap* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataMap, this->GetRecycler());
-    MapDataKeyValuePair complexPair(key, value);
 
-    MapDataNode* node = this->list.Append(complexPair, this->GetRecycler());
+    uint32 index = this->AppendToList(key, value);
 
-    newComplexSet->Add(key, node);
+    newComplexSet->Add(key, index);
 
     this->u.complexVarMap = newComplexSet;
     this->kind = MapKind::ComplexVarMap;
@@ -562,16 +587,15 @@ JavascriptMap::TrySetOnSimpleVarMap(Var key, Var value)
         return false;
     }
 
-    MapDataNode* node = nullptr;
-    if (this->u.simpleVarMap->TryGetValue(simpleVar, &node))
+    uint32 index = 0;
+    if (this->u.simpleVarMap->TryGetValue(simpleVar, &index))
     {
-        node->data = MapDataKeyValuePair(simpleVar, value);
+        this->list.Item(index) = MapDataKeyValuePair(simpleVar, value);
         return true;
     }
 
-    MapDataKeyValuePair pair(simpleVar, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.simpleVarMap->Add(simpleVar, newNode);
+    uint32 newIndex = this->AppendToList(simpleVar, value);
+    this->u.simpleVarMap->Add(simpleVar, newIndex);
     return true;
 }
 
@@ -580,16 +604,15 @@ JavascriptMap::SetOnComplexVarMap(Var key, Var value)
 {
     Assert(this->kind == MapKind::ComplexVarMap);
 
-    MapDataNode* node = nullptr;
-    if (this->u.complexVarMap->TryGetValue(key, &node))
+    uint32 index = 0;
+    if (this->u.complexVarMap->TryGetValue(key, &index))
     {
-        node->data = MapDataKeyValuePair(key, value);
+        this->list.Item(index) = MapDataKeyValuePair(key, value);
         return;
     }
 
-    MapDataKeyValuePair pair(key, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.complexVarMap->Add(key, newNode);
+    uint32 newIndex = this->AppendToList(key, value);
+    this->u.complexVarMap->Add(key, newIndex);
 }
 
 void
@@ -297,7 +297,7 @@ JavascriptSet::CreateVarSetFromList(uint initialCapacity)
     // TODO: we can use a more efficient Iterator, since we know there will be no side effects
     while (iter.Next())
     {
-        varSet->Add(iter.Current(), iter.CurrentNode());
+        varSet->Add(iter.Current(), iter.CurrentIndex());
     }
     return varSet;
 }
@@ -331,6 +331,35 @@ JavascriptSet::PromoteToComplexVarSet()
     this->u.complexVarSet = newSet;
 }
 
+uint32
+JavascriptSet::AppendToList(Var value)
+{
+    return this->list.Append(value, this->GetRecycler(), [this](Var movedValue, uint32 newIndex)
+    {
+        this->UpdateIndex(movedValue, newIndex);
+    });
+}
+
+void
+JavascriptSet::UpdateIndex(Var value, uint32 index)
+{
+    switch (this->kind)
+    {
+    case SetKind::IntSet:
+        // Int sets don't track list indices
+        return;
+    case SetKind::SimpleVarSet:
+        this->u.simpleVarSet->Item(value, index);
+        return;
+    case SetKind::ComplexVarSet:
+        this->u.complexVarSet->Item(value, index);
+        return;
+    default:
+        // Entries only move when the list is full, which it can't be for an empty set
+        Assume(UNREACHED);
+    }
+}
+
 void
 JavascriptSet::AddToEmptySet(Var value)
 {
@@ -344,7 +373,7 @@ JavascriptSet::AddToEmptySet(Var value)
         BVSparse<Recycler>* newIntSet = RecyclerNew(this->GetRecycler(), BVSparse<Recycler>, this->GetRecycler());
         newIntSet->Set(intVal);
 
-        this->list.Append(taggedInt, this->GetRecycler());
+        this->AppendToList(taggedInt);
 
         this->u.intSet = newIntSet;
         this->kind = SetKind::IntSet;
@@ -355,9 +384,9 @@ JavascriptSet::AddToEmptySet(Var value)
     if (simpleVar)
     {
         SimpleVarDataSet* newSimpleSet = RecyclerNew(this->GetRecycler(), SimpleVarDataSet, this->GetRecycler());
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
+        uint32 index = this->AppendToList(simpleVar);
 
-        newSimpleSet->Add(simpleVar, node);
+        newSimpleSet->Add(simpleVar, index);
 
         this->u.simpleVarSet = newSimpleSet;
         this->kind = SetKind::SimpleVarSet;
@@ -365,9 +394,9 @@ JavascriptSet::AddToEmptySet(Var value)
     }
 
     ComplexVarDataSet* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataSet, this->GetRecycler());
-    SetDataNode* node = this->list.Append(value, this->GetRecycler());
+    uint32 index = this->AppendToList(value);
 
-    newComplexSet->Add(value, node);
+    newComplexSet->Add(value, index);
 
     this->u.complexVarSet = newComplexSet;
     this->kind = SetKind::ComplexVarSet;
@@ -386,7 +415,7 @@ JavascriptSet::TryAddToIntSet(Var value)
     int32 intVal = TaggedInt::ToInt32(taggedInt);
     if (!this->u.intSet->TestAndSet(intVal))
     {
-        this->list.Append(taggedInt, this->GetRecycler());
+        this->AppendToList(taggedInt);
     }
     return true;
 }
@@ -403,8 +432,8 @@ JavascriptSet::TryAddToSimpleVarSet(Var value)
 
     if (!this->u.simpleVarSet->ContainsKey(simpleVar))
     {
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
-        this->u.simpleVarSet->Add(simpleVar, node);
+        uint32 index = this->AppendToList(simpleVar);
+        this->u.simpleVarSet->Add(simpleVar, index);
     }
 
     return true;
@@ -416,8 +445,8 @@ JavascriptSet::AddToComplexVarSet(Var value)
     Assert(this->kind == SetKind::ComplexVarSet);
     if (!this->u.complexVarSet->ContainsKey(value))
     {
-        SetDataNode* node = this->list.Append(value, this->GetRecycler());
-        this->u.complexVarSet->Add(value, node);
+        uint32 index = this->AppendToList(value);
+        this->u.complexVarSet->Add(value, index);
     }
 }
 
@@ -512,15 +541,15 @@ bool
 JavascriptSet::DeleteFromVarSet(Var value)
 {
     Assert(this->kind == (isComplex ? SetKind::ComplexVarSet : SetKind::SimpleVarSet));
-    SetDataNode * node = nullptr;
+    uint32 index = 0;
     if (isComplex
-        ? !this->u.complexVarSet->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarSet->TryGetValueAndRemove(value, &node))
+        ? !this->u.complexVarSet->TryGetValueAndRemove(value, &index)
+        : !this->u.simpleVarSet->TryGetValueAndRemove(value, &index))
     {
         return false;
     }
 
-    this->list.Remove(node);
+    this->list.Remove(index);
     return true;
 }
 
@@ -550,7 +579,7 @@ bool JavascriptSet::Delete(Var value)
         {
             return false;
         }
-        // We don't have the list node pointer readily available, so deletion from int sets would require walking the list
+        // We don't have the list index readily available, so deletion from int sets would require walking the list
         // Because of this, let's just promote to a var set
         //
         // If this promotion becomes an issue, we can consider options to improve this, e.g. deferring until an iterator is requested
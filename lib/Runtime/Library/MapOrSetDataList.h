@@ -4,16 +4,20 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-// This is a special use doubly linked list whose iterators are always valid
-// no matter what modifications are made to the list during iteration. The
-// iterators rely on deleted nodes still having valid next and prev references
-// to the nodes they used to be next to before being removed. They also rely
-// on nodes being recycler allocated so that active iterators do not need to
-// be tracked by the list and updated when deletes occur. Finally, well
-// defined iteration order is maintained by only allowing new items to be
-// appended to the end of the list. This allows an iterator to validate
-// itself by seeking backwards until it finds a node whose previous's next
-// still points to it.
+// This is a special use insertion ordered list whose iterators are always
+// valid no matter what modifications are made to the list during iteration.
+//
+// Items are stored densely, in insertion order, in a recycler allocated
+// store and are addressed by their index in it, which the owning Map or Set
+// keeps as the value in its hash table. Removing an item leaves a hole in
+// its slot. When the store fills up, the remaining items are copied, in
+// order, into a new store (grown if most of the items are still live) and
+// the old store is linked to the new one. Iterators are not tracked by the
+// list: an iterator that finds its store replaced follows the link and
+// recomputes its position by counting the live items before it in the old
+// store, which is left untouched once replaced. Clearing the list marks the
+// store as cleared, so that its iterators restart at the beginning of
+// whatever store comes next.
 //
 // The intended use of this list is to track insertion order for items added
 // to ES6 Map and Set objects. If a more general use if found for this data
@@ -21,172 +25,194 @@
 
 namespace Js
 {
+    // Removed items are marked by a null key, which is never a valid Map key or Set value
+    inline bool IsRemovedMapOrSetData(const Var& data) { return data == nullptr; }
+    inline void MarkRemovedMapOrSetData(Field(Var)& data) { data = nullptr; }
+
+    template <typename TKey, typename TValue>
+    inline bool IsRemovedMapOrSetData(const JsUtil::KeyValuePair<TKey, TValue>& data) { return data.Key() == nullptr; }
+    template <typename TKey, typename TValue>
+    inline void MarkRemovedMapOrSetData(JsUtil::KeyValuePair<TKey, TValue>& data) { data = JsUtil::KeyValuePair<TKey, TValue>(nullptr, nullptr); }
+
     template <typename TData>
-    class MapOrSetDataNode
+    class MapOrSetDataStore
     {
     private:
-        template <typename TData>
+        template <typename T>
         friend class MapOrSetDataList;
 
-        Field(MapOrSetDataNode<TData>*) next;
-        Field(MapOrSetDataNode<TData>*) prev;
+        Field(MapOrSetDataStore<TData>*) next;  // The store that replaced this one, if any
+        Field(uint32) count;                    // Number of slots used, including removed items
+        Field(uint32) capacity;
+        Field(bool) isCleared;
+        Field(TData) items[];
 
-        MapOrSetDataNode(TData& data) : data(data), next(nullptr), prev(nullptr) { }
+        MapOrSetDataStore(uint32 capacity) : next(nullptr), count(0), capacity(capacity), isCleared(false) { }
 
-    public:
-        Field(TData) data;
+        static MapOrSetDataStore<TData>* New(uint32 capacity, Recycler* recycler)
+        {
+            const size_t itemsSize = AllocSizeMath::Mul(capacity, sizeof(TData));
+            return RecyclerNewPlusZ(recycler, itemsSize, MapOrSetDataStore<TData>, capacity);
+        }
+
+        uint32 CountLiveItemsBefore(uint32 index) const
+        {
+            Assert(index <= count);
+            uint32 liveCount = 0;
+            for (uint32 i = 0; i < index; i++)
+            {
+                if (!IsRemovedMapOrSetData(items[i]))
+                {
+                    liveCount++;
+                }
+            }
+            return liveCount;
+        }
     };
 
     template <typename TData>
     class MapOrSetDataList
     {
     private:
-        Field(MapOrSetDataNode<TData>*) first;
-        Field(MapOrSetDataNode<TData>*) last;
+        typedef MapOrSetDataStore<TData> Store;
+
+        static const uint32 InitialCapacity = 8;
+
+        Field(Store*) store;
+        Field(uint32) liveCount;
 
     public:
         MapOrSetDataList(VirtualTableInfoCtorEnum) {};
-        MapOrSetDataList() : first(nullptr), last(nullptr) { }
+        MapOrSetDataList() : store(nullptr), liveCount(0) { }
 
         class Iterator
         {
             Field(MapOrSetDataList<TData>*) list;
-            Field(MapOrSetDataNode<TData>*) current;
+            Field(Store*) store;
+            Field(uint32) nextIndex;
+            Field(uint32) currentIndex;
+
+            void Synchronize()
+            {
+                // Follow any stores that replaced ours since we last looked, translating our position
+                while (store != nullptr && store != list->store)
+                {
+                    nextIndex = store->isCleared ? 0 : store->CountLiveItemsBefore(nextIndex);
+                    store = store->next;
+                }
+
+                if (store == nullptr)
+                {
+                    // Either the list was empty when we started or it was cleared; resume with its current store
+                    store = list->store;
+                    nextIndex = 0;
+                }
+            }
+
         public:
-            Iterator() : list(nullptr), current(nullptr) { }
-            Iterator(MapOrSetDataList<TData>* list) : list(list), current(nullptr) { }
+            Iterator() : list(nullptr), store(nullptr), nextIndex(0), currentIndex(0) { }
+            Iterator(MapOrSetDataList<TData>* list) : list(list), store(list->store), nextIndex(0), currentIndex(0) { }
 
             bool Next()
             {
-                // Nodes can be deleted while iterating so validate current
-                // and if it is not valid find last valid node by following
-                // previous toward first.
-                // Note: clear will simply null out first and last, but
-                // not invalidated nodes, so we must also check to see that
-                // first is not null
-
-                if (list == nullptr || list->first == nullptr)
+                if (list == nullptr)
                 {
-                    // list is empty or was cleared during enumeration
-                    list = nullptr;
-                    current = nullptr;
                     return false;
                 }
 
-                if (current)
-                {
-                    while (current->prev && current->prev->next != current)
-                    {
-                        current = current->prev;
-                    }
+                Synchronize();
 
-                    if (current->prev == nullptr && current != list->first)
+                if (store != nullptr)
+                {
+                    while (nextIndex < store->count)
                     {
-                        current = list->first;
-
-                        if (current != nullptr)
+                        const uint32 index = nextIndex++;
+                        if (!IsRemovedMapOrSetData(store->items[index]))
                         {
+                            currentIndex = index;
                             return true;
                         }
-
-                        list = nullptr;
-                        current = nullptr;
-                        return false;
-                    }
-
-                    if (current->next == nullptr && current != list->last)
-                    {
-                        Assert(list->last == nullptr);
-                        current = nullptr;
                     }
                 }
 
-                if (current != list->last)
-                {
-                    if (current == nullptr)
-                    {
-                        Assert(list->first != nullptr);
-                        current = list->first;
-                    }
-                    else
-                    {
-                        current = current->next;
-                    }
-                    return true;
-                }
-
+                // Once done, an iterator stays done even if items are added later
                 list = nullptr;
-                current = nullptr;
+                store = nullptr;
                 return false;
             }
 
             const TData& Current() const
             {
-                return current->data;
+                Assert(store != nullptr && currentIndex < store->count);
+                return store->items[currentIndex];
             }
 
-            Field(MapOrSetDataNode<TData>*) CurrentNode() const
+            // Only meaningful while the list has not been modified since the call to Next
+            uint32 CurrentIndex() const
             {
-                return current;
+                Assert(store == list->store);
+                return currentIndex;
             }
         };
 
         void Clear()
         {
-            first = nullptr;
-            last = nullptr;
+            if (store != nullptr)
+            {
+                store->isCleared = true;
+                store = nullptr;
+            }
+            liveCount = 0;
         }
 
-        MapOrSetDataNode<TData>* Append(TData& data, Recycler* recycler)
+        // Appends the item and returns its index. If existing items have to be moved to make room,
+        // onMoved(item, newIndex) is called for each of them before the new item is appended.
+        template <typename TOnMoved>
+        uint32 Append(const TData& data, Recycler* recycler, TOnMoved onMoved)
         {
-            // Must allocate with the recycler so that iterators can continue
-            // to point to removed nodes.  That is, cannot delete nodes when
-            // they are removed.  Reference counting would also work.
-            MapOrSetDataNode<TData>* newNode = RecyclerNew(recycler, MapOrSetDataNode<TData>, data);
-
-            if (last == nullptr)
+            if (store == nullptr)
             {
-                Assert(first == nullptr);
-                first = newNode;
-                last = newNode;
+                store = Store::New(InitialCapacity, recycler);
             }
-            else
+            else if (store->count == store->capacity)
             {
-                newNode->prev = last;
-                last->next = newNode;
-                last = newNode;
+                // Only grow if the store is mostly live; otherwise compacting makes enough room
+                const uint32 newCapacity = liveCount >= store->capacity / 2 ? UInt32Math::Mul(store->capacity, 2) : store->capacity;
+                Store* newStore = Store::New(newCapacity, recycler);
+
+                for (uint32 i = 0; i < store->count; i++)
+                {
+                    if (!IsRemovedMapOrSetData(store->items[i]))
+                    {
+                        const uint32 newIndex = newStore->count++;
+                        newStore->items[newIndex] = store->items[i];
+                        onMoved(newStore->items[newIndex], newIndex);
+                    }
+                }
+                Assert(newStore->count == liveCount);
+
+                store->next = newStore;
+                store = newStore;
             }
 
-            return newNode;
+            const uint32 index = store->count++;
+            store->items[index] = data;
+            liveCount++;
+            return index;
         }
 
-        void Remove(MapOrSetDataNode<TData>* node)
+        Field(TData)& Item(uint32 index)
         {
-            // Cannot delete the node itself, nor change its next and prev pointers!
-            // Otherwise active iterators may break. Iterators depend on nodes existing
-            // until garbage collector picks them up.
-            auto next = node->next;
-            auto prev = node->prev;
-
-            if (next)
-            {
-                next->prev = prev;
-            }
-            else
-            {
-                Assert(last == node);
-                last = prev;
-            }
+            Assert(store != nullptr && index < store->count && !IsRemovedMapOrSetData(store->items[index]));
+            return store->items[index];
+        }
 
-            if (prev)
-            {
-                prev->next = next;
-            }
-            else
-            {
-                Assert(first == node);
-                first = next;
-            }
+        void Remove(uint32 index)
+        {
+            // The slot is left as a hole rather than shifting later items, so that
+            // indices held by the hash table and by active iterators stay valid
+            MarkRemovedMapOrSetData(Item(index));
+            liveCount--;
         }
 
         Iterator GetIterator()
@@ -194,12 +220,4 @@ namespace Js
             return Iterator(this);
         }
     };
-
-
-    template <typename TData>
-    class DelayedDeleteMapOrSetDataList : MapOrSetDataList<TData>
-    {
-        Field(SList<TData>*) deletedList;
-
-    };
 }
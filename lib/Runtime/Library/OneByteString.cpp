@@ -0,0 +1,105 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    OneByteString::OneByteString(_In_reads_(charLength) const char* content, charcount_t charLength, _In_ StaticType* type) :
+        JavascriptString(type),
+        oneByteBuffer(content)
+    {
+        // Use SetLength to ensure length is valid
+        SetLength(charLength);
+    }
+
+    OneByteString* OneByteString::NewCopyBuffer(_In_reads_(charLength) const char* content, charcount_t charLength, _In_ JavascriptLibrary* library)
+    {
+        Assert(content != nullptr);
+        Assert(charLength >= MinCharCount);
+
+        Recycler* recycler = library->GetRecycler();
+        char* buffer = RecyclerNewArrayLeaf(recycler, char, charLength);
+        js_memcpy_s(buffer, charLength, content, charLength);
+
+        return RecyclerNew(recycler, OneByteString, buffer, charLength, library->GetStringTypeStatic());
+    }
+
+    bool OneByteString::IsAscii(_In_reads_(charLength) const char* content, charcount_t charLength)
+    {
+        // No early exit, so that the compiler can vectorize the loop
+        const uint8* bytes = reinterpret_cast<const uint8*>(content);
+        uint8 bits = 0;
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            bits |= bytes[i];
+        }
+        return (bits & 0x80) == 0;
+    }
+
+    void OneByteString::Widen(_Out_writes_(charLength) char16* dst, _In_reads_(charLength) const char* src, charcount_t charLength)
+    {
+        const uint8* bytes = reinterpret_cast<const uint8*>(src);
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            dst[i] = static_cast<char16>(bytes[i]);
+        }
+    }
+
+    const char16* OneByteString::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return this->UnsafeGetBuffer();
+        }
+
+        const charcount_t allocSize = this->SafeSzSize();
+
+        Recycler* recycler = GetScriptContext()->GetRecycler();
+        char16* target = RecyclerNewArrayLeaf(recycler, char16, allocSize);
+
+        Widen(target, this->oneByteBuffer, this->GetLength());
+        target[this->GetLength()] = _u('\0');
+
+        this->SetBuffer(target);
+
+        // Everything from here on uses the wide buffer; let the recycler reclaim the one-byte copy
+        this->oneByteBuffer = nullptr;
+
+        return target;
+    }
+
+    size_t OneByteString::GetAllocatedByteCount() const
+    {
+        if (!this->IsFinalized())
+        {
+            return this->GetLength() * sizeof(char);
+        }
+        return __super::GetAllocatedByteCount();
+    }
+
+    void OneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());   // CopyVirtual should only be called for unfinalized buffers
+
+        // Copy straight into the destination without creating our own wide buffer
+        Widen(buffer, this->oneByteBuffer, this->GetLength());
+    }
+
+    bool OneByteString::Is(Var var)
+    {
+        return RecyclableObject::Is(var) && VirtualTableInfo<OneByteString>::HasVirtualTable(RecyclableObject::FromVar(var));
+    }
+
+    OneByteString* OneByteString::TryFromVar(Var var)
+    {
+        return OneByteString::Is(var)
+            ? reinterpret_cast<OneByteString*>(var)
+            : nullptr;
+    }
+}
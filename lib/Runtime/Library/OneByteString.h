@@ -0,0 +1,43 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // A string whose characters are all Latin-1 (<= 0xFF), stored one byte per character.
+    // The UTF-16 buffer is only created when GetSz/GetString is called, at which point the one-byte
+    // copy is dropped. Until then the string takes half the memory, can be copied into a flattened
+    // parent (concat strings) without an intermediate buffer, and can be handed back to narrow
+    // JSRT callers without conversion.
+    class OneByteString sealed : public JavascriptString
+    {
+    private:
+        Field(const char*) oneByteBuffer;   // Latin-1 contents, not '\0' terminated; nullptr once widened
+
+        OneByteString(_In_reads_(charLength) const char* content, charcount_t charLength, _In_ StaticType* type);
+
+        static void Widen(_Out_writes_(charLength) char16* dst, _In_reads_(charLength) const char* src, charcount_t charLength);
+
+    protected:
+        DEFINE_VTABLE_CTOR(OneByteString, JavascriptString);
+
+    public:
+        // Short strings are likely to be used as property names, which need the wide buffer right away
+        static const charcount_t MinCharCount = 32;
+
+        static OneByteString* NewCopyBuffer(_In_reads_(charLength) const char* content, charcount_t charLength, _In_ JavascriptLibrary* library);
+        static bool IsAscii(_In_reads_(charLength) const char* content, charcount_t charLength);
+
+        // Returns the one-byte contents, or nullptr if the string has already been widened
+        const char* GetOneByteBuffer() const { return this->oneByteBuffer; }
+
+        virtual const char16* GetSz() override;
+        virtual size_t GetAllocatedByteCount() const override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+
+        static bool Is(Var var);
+        static OneByteString* TryFromVar(Var var);
+    };
+}
@@ -2506,6 +2506,435 @@ namespace Js
         }
     }
 
+    // Without a comparator, sort never calls out to script and only the values of the elements matter. Instead of
+    // going through qsort and a comparison callback, each element is mapped to an unsigned key that orders the same
+    // way (NaN last, -0 before +0) and the keys are sorted by counting them (one byte elements) or with a least
+    // significant digit radix sort. Large arrays are split into chunks that are sorted, then merged, on several threads.
+    template <typename T> struct TypedArraySortKey;
+
+#define TYPEDARRAY_UNSIGNED_SORT_KEY(T) \
+    template <> struct TypedArraySortKey<T> \
+    { \
+        typedef T KeyType; \
+        static KeyType ToKey(T value) { return value; } \
+        static T FromKey(KeyType key) { return key; } \
+    };
+
+#define TYPEDARRAY_SIGNED_SORT_KEY(T, TKey) \
+    template <> struct TypedArraySortKey<T> \
+    { \
+        typedef TKey KeyType; \
+        static const KeyType SignBit = (KeyType)1 << (sizeof(KeyType) * 8 - 1); \
+        static KeyType ToKey(T value) { return (KeyType)((KeyType)value ^ SignBit); } \
+        static T FromKey(KeyType key) { return (T)(KeyType)(key ^ SignBit); } \
+    };
+
+#define TYPEDARRAY_FLOAT_SORT_KEY(T, TKey) \
+    template <> struct TypedArraySortKey<T> \
+    { \
+        typedef TKey KeyType; \
+        static const KeyType SignBit = (KeyType)1 << (sizeof(KeyType) * 8 - 1); \
+        static KeyType ToKey(T value) \
+        { \
+            if (NumberUtilities::IsNan(value)) \
+            { \
+                /* Only a NaN has all the bits set once mapped, so NaNs sort last */ \
+                return (KeyType)-1; \
+            } \
+            KeyType bits; \
+            memcpy(&bits, &value, sizeof(bits)); \
+            return (bits & SignBit) ? ~bits : (bits | SignBit); \
+        } \
+        static T FromKey(KeyType key) \
+        { \
+            if (key == (KeyType)-1) \
+            { \
+                return (T)JavascriptNumber::NaN; \
+            } \
+            KeyType bits = (key & SignBit) ? (key & ~SignBit) : ~key; \
+            T value; \
+            memcpy(&value, &bits, sizeof(value)); \
+            return value; \
+        } \
+    };
+
+    TYPEDARRAY_UNSIGNED_SORT_KEY(uint8)
+    TYPEDARRAY_UNSIGNED_SORT_KEY(uint16)
+    TYPEDARRAY_UNSIGNED_SORT_KEY(uint32)
+    TYPEDARRAY_UNSIGNED_SORT_KEY(uint64)
+    TYPEDARRAY_SIGNED_SORT_KEY(int8, uint8)
+    TYPEDARRAY_SIGNED_SORT_KEY(int16, uint16)
+    TYPEDARRAY_SIGNED_SORT_KEY(int32, uint32)
+    TYPEDARRAY_SIGNED_SORT_KEY(int64, uint64)
+    TYPEDARRAY_FLOAT_SORT_KEY(float, uint32)
+    TYPEDARRAY_FLOAT_SORT_KEY(double, uint64)
+
+#undef TYPEDARRAY_UNSIGNED_SORT_KEY
+#undef TYPEDARRAY_SIGNED_SORT_KEY
+#undef TYPEDARRAY_FLOAT_SORT_KEY
+
+    template <> struct TypedArraySortKey<bool>
+    {
+        typedef uint8 KeyType;
+        static KeyType ToKey(bool value) { return value ? 1 : 0; }
+        static bool FromKey(KeyType key) { return key != 0; }
+    };
+
+    // Below this length, an insertion sort beats setting up the radix sort
+    static const uint32 TypedArrayInsertionSortMaxLength = 32;
+    static const uint32 TypedArraySortMaxThreadCount = 8;
+
+    template <typename TKey>
+    static void TypedArrayInsertionSortKeys(TKey* keys, uint32 length)
+    {
+        for (uint32 i = 1; i < length; i++)
+        {
+            const TKey key = keys[i];
+            uint32 j = i;
+            for (; j > 0 && keys[j - 1] > key; j--)
+            {
+                keys[j] = keys[j - 1];
+            }
+            keys[j] = key;
+        }
+    }
+
+    template <typename TKey>
+    static void TypedArrayCountingSortKeys(TKey* keys, uint32 length)
+    {
+        Assert(sizeof(TKey) == 1);
+
+        uint32 counts[256] = { 0 };
+        for (uint32 i = 0; i < length; i++)
+        {
+            counts[(uint8)keys[i]]++;
+        }
+
+        uint32 index = 0;
+        for (uint32 key = 0; key < 256; key++)
+        {
+            for (uint32 count = counts[key]; count > 0; count--)
+            {
+                keys[index++] = (TKey)key;
+            }
+        }
+        Assert(index == length);
+    }
+
+    // Returns the buffer holding the sorted keys, either keys or scratch
+    template <typename TKey>
+    static TKey* TypedArrayRadixSortKeys(TKey* keys, TKey* scratch, uint32 length)
+    {
+        if (length <= TypedArrayInsertionSortMaxLength)
+        {
+            TypedArrayInsertionSortKeys(keys, length);
+            return keys;
+        }
+
+        // Histogram all the digits in a single pass
+        uint32 counts[sizeof(TKey)][256] = { { 0 } };
+        for (uint32 i = 0; i < length; i++)
+        {
+            const TKey key = keys[i];
+            for (uint digit = 0; digit < sizeof(TKey); digit++)
+            {
+                counts[digit][(key >> (digit * 8)) & 0xFF]++;
+            }
+        }
+
+        TKey* src = keys;
+        TKey* dst = scratch;
+        for (uint digit = 0; digit < sizeof(TKey); digit++)
+        {
+            uint32* digitCounts = counts[digit];
+            const uint shift = digit * 8;
+
+            // Skip the digits that are the same for all the keys, such as the high bytes of small integers
+            if (digitCounts[(src[0] >> shift) & 0xFF] == length)
+            {
+                continue;
+            }
+
+            uint32 offset = 0;
+            for (uint bucket = 0; bucket < 256; bucket++)
+            {
+                const uint32 count = digitCounts[bucket];
+                digitCounts[bucket] = offset;
+                offset += count;
+            }
+
+            for (uint32 i = 0; i < length; i++)
+            {
+                const TKey key = src[i];
+                dst[digitCounts[(key >> shift) & 0xFF]++] = key;
+            }
+
+            TKey* temp = src;
+            src = dst;
+            dst = temp;
+        }
+        return src;
+    }
+
+    template <typename TKey>
+    static void TypedArrayMergeKeys(const TKey* left, uint32 leftLength, const TKey* right, uint32 rightLength, TKey* dst)
+    {
+        const TKey* leftEnd = left + leftLength;
+        const TKey* rightEnd = right + rightLength;
+        while (left < leftEnd && right < rightEnd)
+        {
+            *dst++ = *right < *left ? *right++ : *left++;
+        }
+        while (left < leftEnd)
+        {
+            *dst++ = *left++;
+        }
+        while (right < rightEnd)
+        {
+            *dst++ = *right++;
+        }
+    }
+
+    // A chunk of work for one thread of a parallel sort: either sorting a run of keys in place, or merging two runs
+    template <typename TKey>
+    struct TypedArraySortTask
+    {
+        TKey* keys;
+        TKey* scratch;
+        uint32 length;
+        const TKey* right;
+        uint32 rightLength;
+
+        void InitSort(TKey* keys, TKey* scratch, uint32 length)
+        {
+            this->keys = keys;
+            this->scratch = scratch;
+            this->length = length;
+            this->right = nullptr;
+            this->rightLength = 0;
+        }
+
+        void InitMerge(TKey* left, uint32 leftLength, const TKey* right, uint32 rightLength, TKey* dst)
+        {
+            this->keys = left;
+            this->length = leftLength;
+            this->right = right;
+            this->rightLength = rightLength;
+            this->scratch = dst;
+        }
+
+        void Run()
+        {
+            if (this->right == nullptr)
+            {
+                // The runs are merged from the keys buffer, so each run must end up there
+                TKey* sorted = TypedArrayRadixSortKeys(this->keys, this->scratch, this->length);
+                if (sorted != this->keys)
+                {
+                    js_memcpy_s(this->keys, this->length * sizeof(TKey), sorted, this->length * sizeof(TKey));
+                }
+            }
+            else
+            {
+                TypedArrayMergeKeys(this->keys, this->length, this->right, this->rightLength, this->scratch);
+            }
+        }
+    };
+
+#if ENABLE_NATIVE_CODEGEN && ENABLE_BACKGROUND_JOB_PROCESSOR
+    // Queues one task on the thread context's background job processor, so that the threads are reused across sorts
+    template <typename TKey>
+    class TypedArraySortJobManager sealed : public JsUtil::WaitableSingleJobManager
+    {
+    public:
+        TypedArraySortJobManager(JsUtil::JobProcessor *const processor, TypedArraySortTask<TKey> *const task)
+            : JsUtil::WaitableSingleJobManager(processor), task(task)
+        {
+            Processor()->AddManager(this);
+        }
+
+        ~TypedArraySortJobManager()
+        {
+            Processor()->RemoveManager(this);
+        }
+
+        // A task that no background thread has started yet, for instance because they are busy with JIT jobs, is
+        // run by the waiting thread instead
+        bool ShouldProcessInForeground(const bool willWaitForJob, const unsigned int numJobsInQueue) const
+        {
+            return true;
+        }
+
+        void WaitForJobProcessed()
+        {
+            Processor()->PrioritizeJobAndWait(this, false);
+        }
+
+    protected:
+        virtual bool Process(JsUtil::Job *const job, JsUtil::ParallelThreadData *threadData) override
+        {
+            this->task->Run();
+            return true;
+        }
+
+    private:
+        TypedArraySortTask<TKey> *const task;
+    };
+
+    // Runs the first task on the calling thread and queues the others on the job processor, and waits for all of them
+    template <typename TKey>
+    static void TypedArrayRunSortTasks(TypedArraySortTask<TKey>* tasks, uint32 taskCount, JsUtil::JobProcessor* processor)
+    {
+        Assert(taskCount <= TypedArraySortMaxThreadCount);
+        Assert(processor->ProcessesInBackground());
+
+        typedef TypedArraySortJobManager<TKey> JobManager;
+        JobManager* managers[TypedArraySortMaxThreadCount] = { nullptr };
+        for (uint32 i = 1; i < taskCount; i++)
+        {
+            // Without memory for a job manager, the task is run on the calling thread below
+            managers[i] = HeapNewNoThrow(JobManager, processor, &tasks[i]);
+            if (managers[i] != nullptr)
+            {
+                managers[i]->AddJobToProcessor(false);
+            }
+        }
+
+        tasks[0].Run();
+
+        for (uint32 i = 1; i < taskCount; i++)
+        {
+            if (managers[i] != nullptr)
+            {
+                managers[i]->WaitForJobProcessed();
+                HeapDelete(managers[i]);
+            }
+            else
+            {
+                tasks[i].Run();
+            }
+        }
+    }
+
+    // Sorts taskCount runs of the keys concurrently, then merges them
+    template <typename TKey>
+    static TKey* TypedArrayParallelSortKeys(TKey* keys, TKey* scratch, uint32 length, uint32 taskCount, JsUtil::JobProcessor* processor)
+    {
+        TypedArraySortTask<TKey> tasks[TypedArraySortMaxThreadCount];
+        uint32 runStarts[TypedArraySortMaxThreadCount + 1];
+        for (uint32 i = 0; i < taskCount; i++)
+        {
+            runStarts[i] = (uint32)(((uint64)length * i) / taskCount);
+        }
+        runStarts[taskCount] = length;
+
+        for (uint32 i = 0; i < taskCount; i++)
+        {
+            tasks[i].InitSort(keys + runStarts[i], scratch + runStarts[i], runStarts[i + 1] - runStarts[i]);
+        }
+        TypedArrayRunSortTasks(tasks, taskCount, processor);
+
+        // Merge pairs of sorted runs, going back and forth between the two buffers, until a single run is left
+        TKey* src = keys;
+        TKey* dst = scratch;
+        for (uint32 runCount = taskCount; runCount > 1; runCount /= 2)
+        {
+            for (uint32 i = 0; i < runCount / 2; i++)
+            {
+                const uint32 start = runStarts[2 * i];
+                const uint32 middle = runStarts[2 * i + 1];
+                const uint32 end = runStarts[2 * i + 2];
+                tasks[i].InitMerge(src + start, middle - start, src + middle, end - middle, dst + start);
+                runStarts[i] = start;
+            }
+            runStarts[runCount / 2] = length;
+            TypedArrayRunSortTasks(tasks, runCount / 2, processor);
+
+            TKey* temp = src;
+            src = dst;
+            dst = temp;
+        }
+        return src;
+    }
+#endif
+
+    // Returns the buffer holding the sorted keys, either keys or scratch
+    template <typename TKey>
+    static TKey* TypedArraySortKeys(TKey* keys, TKey* scratch, uint32 length, JsUtil::JobProcessor* processor)
+    {
+#if ENABLE_NATIVE_CODEGEN && ENABLE_BACKGROUND_JOB_PROCESSOR
+        uint32 taskCount = 1;
+        if (processor != nullptr && length >= (uint32)CONFIG_FLAG(TypedArraySortParallelThreshold))
+        {
+            // The runs are merged pairwise, so use a power of two number of threads
+            const uint32 processorCount = min((uint32)AutoSystemInfo::Data.GetNumberOfLogicalProcessors(), TypedArraySortMaxThreadCount);
+            while (taskCount * 2 <= processorCount && length / (taskCount * 2) > TypedArrayInsertionSortMaxLength)
+            {
+                taskCount *= 2;
+            }
+        }
+
+        if (taskCount > 1)
+        {
+            return TypedArrayParallelSortKeys(keys, scratch, length, taskCount, processor);
+        }
+#else
+        Unused(processor);
+#endif
+        return TypedArrayRadixSortKeys(keys, scratch, length);
+    }
+
+    template<typename T> bool TypedArraySortElementsHelper(void* buffer, uint32 length, JsUtil::JobProcessor* processor)
+    {
+        typedef TypedArraySortKey<T> SortKey;
+        typedef typename SortKey::KeyType KeyType;
+        CompileAssert(sizeof(KeyType) == sizeof(T));
+
+        T* elements = static_cast<T*>(buffer);
+        KeyType* keys = static_cast<KeyType*>(buffer);
+
+        KeyType* scratch = nullptr;
+        if (sizeof(KeyType) > 1 && length > TypedArrayInsertionSortMaxLength)
+        {
+            scratch = HeapNewNoThrowArray(KeyType, length);
+            if (scratch == nullptr)
+            {
+                return false;
+            }
+        }
+
+        // The keys are the same size as the elements, so they are computed in place
+        for (uint32 i = 0; i < length; i++)
+        {
+            keys[i] = SortKey::ToKey(elements[i]);
+        }
+
+        KeyType* sorted = keys;
+        if (sizeof(KeyType) == 1)
+        {
+            TypedArrayCountingSortKeys(keys, length);
+        }
+        else if (scratch == nullptr)
+        {
+            TypedArrayInsertionSortKeys(keys, length);
+        }
+        else
+        {
+            sorted = TypedArraySortKeys(keys, scratch, length, processor);
+        }
+
+        for (uint32 i = 0; i < length; i++)
+        {
+            elements[i] = SortKey::FromKey(sorted[i]);
+        }
+
+        if (scratch != nullptr)
+        {
+            HeapDeleteArray(length, scratch);
+        }
+        return true;
+    }
+
     Var TypedArrayBase::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
     {
         PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
@@ -2538,6 +2967,28 @@ namespace Js
             compareFn = RecyclableObject::FromVar(args[1]);
         }
 
+        // Without a comparator, sort by value unless the memory is shared, where other agents could change the
+        // elements while they are being sorted
+        if (compareFn == nullptr && !typedArrayBase->GetArrayBuffer()->IsSharedArrayBuffer())
+        {
+            // Large arrays are sorted in parallel on the background job processor, unless the host asked for no
+            // background work
+            JsUtil::JobProcessor* processor = nullptr;
+#if ENABLE_NATIVE_CODEGEN && ENABLE_BACKGROUND_JOB_PROCESSOR
+            ThreadContext* threadContext = scriptContext->GetThreadContext();
+            if (!threadContext->IsOptimizedForManyInstances() && threadContext->GetJobProcessor()->ProcessesInBackground())
+            {
+                processor = threadContext->GetJobProcessor();
+            }
+#endif
+
+            SortElementsFunction sortElements = typedArrayBase->GetSortElementsFunction();
+            if (sortElements(typedArrayBase->GetByteBuffer(), length, processor))
+            {
+                return typedArrayBase;
+            }
+        }
+
         // Get the elements comparison function for the type of this TypedArray
         void* elementCompare = reinterpret_cast<void*>(typedArrayBase->GetCompareElementsFunction());
 
@@ -11,6 +11,7 @@ namespace Js
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBufferBase* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascriptLibrary);
 
     template<typename T> int __cdecl TypedArrayCompareElementsHelper(void* context, const void* elem1, const void* elem2);
+    template<typename T> bool TypedArraySortElementsHelper(void* buffer, uint32 length, JsUtil::JobProcessor* processor);
 
     class TypedArrayBase : public ArrayBufferParent
     {
@@ -201,6 +202,10 @@ namespace Js
         typedef int(__cdecl* CompareElementsFunction)(void*, const void*, const void*);
         virtual CompareElementsFunction GetCompareElementsFunction() = 0;
 
+        // Sorts the elements by value when there is no comparator; returns false if it could not get the memory to do so
+        typedef bool(*SortElementsFunction)(void*, uint32, JsUtil::JobProcessor*);
+        virtual SortElementsFunction GetSortElementsFunction() = 0;
+
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
         Field(int32) BYTES_PER_ELEMENT;
         Field(uint32) byteOffset;
@@ -518,6 +523,11 @@ namespace Js
             return &TypedArrayCompareElementsHelper<TypeName>;
         }
 
+        SortElementsFunction GetSortElementsFunction()
+        {
+            return &TypedArraySortElementsHelper<TypeName>;
+        }
+
     public:
         virtual VTableValue DummyVirtualFunctionToHinderLinkerICF();
     };
@@ -580,6 +590,12 @@ namespace Js
             return &TypedArrayCompareElementsHelper<char16>;
         }
 
+        SortElementsFunction GetSortElementsFunction()
+        {
+            // char16 orders like uint16
+            return &TypedArraySortElementsHelper<uint16>;
+        }
+
     public:
         virtual VTableValue DummyVirtualFunctionToHinderLinkerICF()
         {
@@ -598,6 +614,10 @@ namespace Js
         if (arrayBuffer->IsValidVirtualBufferLength(arrayBuffer->GetByteLength()) &&
              (byteOffset == 0) &&
              (mappedLength == (arrayBuffer->GetByteLength() / sizeof(TypeName)))
+#if defined(DISABLE_SEH) && ENABLE_FAST_ARRAYBUFFER
+             // Without SEH, a fault in a wasm memory is taken to be a wasm trap (see JavascriptFunction::HardwareExceptionHandler)
+             && !arrayBuffer->IsWebAssemblyArrayBuffer()
+#endif
            )
         {
             // update the vtable
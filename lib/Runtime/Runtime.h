@@ -493,6 +493,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 
 #include "Library/LiteralString.h"
 #include "Library/ConcatString.h"
+#include "Library/OneByteString.h"
 #include "Library/CompoundString.h"
 #include "Library/PropertyRecordUsageCache.h"
 #include "Library/PropertyString.h"
@@ -241,7 +241,9 @@ typedef void(*AfterSectionCallback)(WasmModuleGenerator*);
 WasmModuleGenerator::WasmModuleGenerator(Js::ScriptContext* scriptContext, Js::WebAssemblySource* src) :
     m_sourceInfo(src->GetSourceInfo()),
     m_scriptContext(scriptContext),
-    m_recycler(scriptContext->GetRecycler())
+    m_recycler(scriptContext->GetRecycler()),
+    m_functionExports(nullptr, 0),
+    m_functionExportsCount(0)
 {
     m_module = RecyclerNewFinalized(m_recycler, Js::WebAssemblyModule, scriptContext, src->GetBuffer(), src->GetBufferLength(), scriptContext->GetLibrary()->GetWebAssemblyModuleType());
 
@@ -301,6 +303,7 @@ Js::WebAssemblyModule* WasmModuleGenerator::GenerateModule()
     sourceContextInfo->nextLocalFunctionId += funcCount;
     sourceContextInfo->EnsureInitialized();
 
+    FindFunctionExports(funcCount);
     for (uint32 i = 0; i < funcCount; ++i)
     {
         GenerateFunctionHeader(i);
@@ -360,6 +363,32 @@ WasmBinaryReader* WasmModuleGenerator::GetReader() const
     return m_module->GetReader();
 }
 
+void WasmModuleGenerator::FindFunctionExports(uint32 funcCount)
+{
+    // Look the exports up once rather than scanning all of them for every unnamed function,
+    // which is quadratic for modules with many functions and exports
+    m_functionExports.Set(HeapNewArrayZ(WasmExport*, funcCount), funcCount);
+    m_functionExportsCount = funcCount;
+    for (uint32 iExport = 0; iExport < m_module->GetExportCount(); ++iExport)
+    {
+        Wasm::WasmExport* wasmExport = m_module->GetExport(iExport);
+        if (wasmExport &&
+            wasmExport->kind == ExternalKinds::Function &&
+            wasmExport->nameLength > 0 &&
+            m_module->GetFunctionIndexType(wasmExport->index) == FunctionIndexTypes::Function &&
+            wasmExport->index < funcCount &&
+            !m_functionExports[wasmExport->index])
+        {
+            m_functionExports[wasmExport->index] = wasmExport;
+        }
+    }
+}
+
+WasmExport* WasmModuleGenerator::GetFunctionExport(uint32 funcNumber) const
+{
+    return funcNumber < m_functionExportsCount ? m_functionExports[funcNumber] : nullptr;
+}
+
 void WasmModuleGenerator::GenerateFunctionHeader(uint32 index)
 {
     WasmFunctionInfo* wasmInfo = m_module->GetWasmFunctionInfo(index);
@@ -378,21 +407,13 @@ void WasmModuleGenerator::GenerateFunctionHeader(uint32 index)
     }
     else
     {
-        for (uint32 iExport = 0; iExport < m_module->GetExportCount(); ++iExport)
+        Wasm::WasmExport* wasmExport = GetFunctionExport(wasmInfo->GetNumber());
+        if (wasmExport)
         {
-            Wasm::WasmExport* wasmExport = m_module->GetExport(iExport);
-            if (wasmExport  &&
-                wasmExport->kind == ExternalKinds::Function &&
-                wasmExport->nameLength > 0 &&
-                m_module->GetFunctionIndexType(wasmExport->index) == FunctionIndexTypes::Function &&
-                wasmExport->index == wasmInfo->GetNumber())
-            {
-                nameLength = wasmExport->nameLength + 16;
-                char16 * autoName = RecyclerNewArrayLeafZ(m_recycler, char16, nameLength);
-                nameLength = swprintf_s(autoName, nameLength, _u("%s[%u]"), wasmExport->name, wasmInfo->GetNumber());
-                functionName = autoName;
-                break;
-            }
+            nameLength = wasmExport->nameLength + 16;
+            char16 * autoName = RecyclerNewArrayLeafZ(m_recycler, char16, nameLength);
+            nameLength = swprintf_s(autoName, nameLength, _u("%s[%u]"), wasmExport->name, wasmInfo->GetNumber());
+            functionName = autoName;
         }
     }
 
@@ -179,11 +179,16 @@ namespace Wasm
         void GenerateFunctionHeader(uint32 index);
     private:
         WasmBinaryReader* GetReader() const;
+        void FindFunctionExports(uint32 funcCount);
+        WasmExport* GetFunctionExport(uint32 funcNumber) const;
 
         Memory::Recycler* m_recycler;
         Js::Utf8SourceInfo* m_sourceInfo;
         Js::ScriptContext* m_scriptContext;
         Js::WebAssemblyModule* m_module;
+        // First named export of each function, indexed by function number
+        AutoArrayPtr<WasmExport*> m_functionExports;
+        uint32 m_functionExportsCount;
     };
 
     class WasmBytecodeGenerator
@@ -4706,6 +4706,16 @@ enum {
 
 #endif // FEATURE_PAL_SXS
 
+// Given the first chance to handle a hardware exception (e.g. an access violation) raised by a signal. Returning TRUE
+// resumes execution with the registers in ContextRecord, which the handler may have modified.
+typedef BOOL (PALAPI *PHARDWARE_EXCEPTION_HANDLER)(PEXCEPTION_POINTERS pointers);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_SetHardwareExceptionHandler(
+    IN PHARDWARE_EXCEPTION_HANDLER exceptionHandler);
+
 //
 // A function table entry is generated for each frame function.
 //
@@ -65,6 +65,7 @@ check_function_exists(pthread_mach_thread_np HAVE_MACH_THREADS)
 check_function_exists(thread_set_exception_ports HAVE_MACH_EXCEPTIONS)
 check_function_exists(vm_allocate HAVE_VM_ALLOCATE)
 check_function_exists(vm_read HAVE_VM_READ)
+check_function_exists(process_vm_readv HAVE_PROCESS_VM_READV)
 check_function_exists(directio HAVE_DIRECTIO)
 check_function_exists(semget HAS_SYSV_SEMAPHORES)
 check_function_exists(pthread_mutex_init HAS_PTHREAD_MUTEXES)
@@ -956,6 +957,7 @@ else() # ANDROID
   set(HAVE__LWP_SELF 0)
   set(HAVE_VM_ALLOCATE 0)
   set(HAVE_VM_READ 0)
+  set(HAVE_PROCESS_VM_READV 0)
   set(HAS_SYSV_SEMAPHORES 0)
   set(HAS_PTHREAD_MUTEXES 1)
   # -DHAVE_TTRACE
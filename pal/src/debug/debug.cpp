@@ -50,6 +50,9 @@ Revision History:
 #else // HAVE_TTRACE
 #include <sys/ptrace.h>
 #endif  // HAVE_PROCFS_CTL
+#if HAVE_PROCESS_VM_READV
+#include <sys/uio.h>
+#endif
 #if HAVE_VM_READ
 #include <mach/mach.h>
 #endif  // HAVE_VM_READ
@@ -553,6 +556,81 @@ SetThreadContext(
     return ret;
 }
 
+#if HAVE_PROCESS_VM_READV
+/*++
+Function:
+  DBGCopyProcessMemory
+
+  Copies memory from (or to, if isWrite) another process with process_vm_readv/writev. Unlike
+  ptrace, this doesn't need to attach to and stop the target process, so it can be used on a live
+  process that keeps running, for instance by an out of process JIT.
+
+  Returns TRUE if all nSize bytes were copied. *pIsSupported is set to FALSE if the kernel doesn't
+  support these calls, in which case the caller should fall back to ptrace.
+--*/
+static
+BOOL
+DBGCopyProcessMemory(
+    DWORD processId,
+    LPVOID localAddress,
+    LPVOID remoteAddress,
+    SIZE_T nSize,
+    BOOL isWrite,
+    SIZE_T *pNumberOfBytesCopied,
+    BOOL *pIsSupported)
+{
+    struct iovec localIov;
+    struct iovec remoteIov;
+    ssize_t bytesCopied;
+
+    localIov.iov_base = localAddress;
+    localIov.iov_len = nSize;
+    remoteIov.iov_base = remoteAddress;
+    remoteIov.iov_len = nSize;
+
+    *pNumberOfBytesCopied = 0;
+    *pIsSupported = TRUE;
+
+    bytesCopied = isWrite ?
+        process_vm_writev(processId, &localIov, 1, &remoteIov, 1, 0) :
+        process_vm_readv(processId, &localIov, 1, &remoteIov, 1, 0);
+    if (bytesCopied == -1)
+    {
+        int copyErrno = errno;
+        if (copyErrno == ENOSYS)
+        {
+            *pIsSupported = FALSE;
+            return FALSE;
+        }
+
+        ERROR("process_vm_%s(pid:%d, addr:%p, size:%d) failed errno=%d (%s)\n",
+              isWrite ? "writev" : "readv", processId, remoteAddress, (int)nSize,
+              copyErrno, strerror(copyErrno));
+        switch (copyErrno)
+        {
+        case EPERM:
+            SetLastError(ERROR_ACCESS_DENIED);
+            break;
+        case ESRCH:
+            SetLastError(ERROR_INVALID_HANDLE);
+            break;
+        default:
+            SetLastError(ERROR_INVALID_ACCESS);
+            break;
+        }
+        return FALSE;
+    }
+
+    *pNumberOfBytesCopied = bytesCopied;
+    if ((SIZE_T)bytesCopied != nSize)
+    {
+        SetLastError(ERROR_PARTIAL_COPY);
+        return FALSE;
+    }
+    return TRUE;
+}
+#endif  // HAVE_PROCESS_VM_READV
+
 /*++
 Function:
   ReadProcessMemory
@@ -645,6 +723,20 @@ ReadProcessMemory(
         goto EXIT;
     }
 
+#if HAVE_PROCESS_VM_READV
+    {
+        SIZE_T bytesCopied;
+        BOOL isSupported;
+        ret = DBGCopyProcessMemory(processId, lpBuffer, (LPVOID)lpBaseAddress, nSize, FALSE, &bytesCopied, &isSupported);
+        numberOfBytesRead = bytesCopied;
+        if (isSupported)
+        {
+            goto EXIT;
+        }
+        // Fall back to attaching to the process below
+    }
+#endif  // HAVE_PROCESS_VM_READV
+
 #if HAVE_VM_READ
     result = task_for_pid(mach_task_self(), processId, &task);
     if (result != KERN_SUCCESS)
@@ -937,6 +1029,20 @@ WriteProcessMemory(
         goto EXIT;
     }
 
+#if HAVE_PROCESS_VM_READV
+    {
+        SIZE_T bytesCopied;
+        BOOL isSupported;
+        ret = DBGCopyProcessMemory(processId, (LPVOID)lpBuffer, lpBaseAddress, nSize, TRUE, &bytesCopied, &isSupported);
+        numberOfBytesWritten = bytesCopied;
+        if (isSupported)
+        {
+            goto EXIT;
+        }
+        // Fall back to attaching to the process below
+    }
+#endif  // HAVE_PROCESS_VM_READV
+
 #if HAVE_VM_READ
     result = task_for_pid(mach_task_self(), processId, &task);
     if (result != KERN_SUCCESS)
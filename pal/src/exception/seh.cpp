@@ -18,3 +18,12 @@ RaiseException(IN DWORD dwExceptionCode,
         abort();
     }
 }
+
+PHARDWARE_EXCEPTION_HANDLER g_hardwareExceptionHandler = NULL;
+
+VOID
+PALAPI
+PAL_SetHardwareExceptionHandler(IN PHARDWARE_EXCEPTION_HANDLER exceptionHandler)
+{
+    g_hardwareExceptionHandler = exceptionHandler;
+}
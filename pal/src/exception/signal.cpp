@@ -65,7 +65,7 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context);
 static void sigtrap_handler(int code, siginfo_t *siginfo, void *context);
 static void sigbus_handler(int code, siginfo_t *siginfo, void *context);
 
-static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
+static BOOL common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
                                   native_context_t *ucontext);
 
 static void inject_activation_handler(int code, siginfo_t *siginfo, void *context);
@@ -81,6 +81,8 @@ struct sigaction g_previous_sigfpe;
 struct sigaction g_previous_sigbus;
 struct sigaction g_previous_sigsegv;
 
+extern PHARDWARE_EXCEPTION_HANDLER g_hardwareExceptionHandler;
+
 
 /* public function definitions ************************************************/
 
@@ -192,7 +194,10 @@ static void sigill_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
-        common_signal_handler(&pointers, code, ucontext);
+        if (common_signal_handler(&pointers, code, ucontext))
+        {
+            return;
+        }
     }
 
     TRACE("SIGILL signal was unhandled; chaining to previous sigaction\n");
@@ -237,7 +242,10 @@ static void sigfpe_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
-        common_signal_handler(&pointers, code, ucontext);
+        if (common_signal_handler(&pointers, code, ucontext))
+        {
+            return;
+        }
     }
 
     TRACE("SIGFPE signal was unhandled; chaining to previous sigaction\n");
@@ -290,7 +298,10 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
-        common_signal_handler(&pointers, code, ucontext);
+        if (common_signal_handler(&pointers, code, ucontext))
+        {
+            return;
+        }
     }
 
     TRACE("SIGSEGV signal was unhandled; chaining to previous sigaction\n");
@@ -335,7 +346,10 @@ static void sigtrap_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
-        common_signal_handler(&pointers, code, ucontext);
+        if (common_signal_handler(&pointers, code, ucontext))
+        {
+            return;
+        }
     }
 
     TRACE("SIGTRAP signal was unhandled; chaining to previous sigaction\n");
@@ -389,7 +403,10 @@ static void sigbus_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
-        common_signal_handler(&pointers, code, ucontext);
+        if (common_signal_handler(&pointers, code, ucontext))
+        {
+            return;
+        }
     }
 
     TRACE("SIGBUS signal was unhandled; chaining to previous sigaction\n");
@@ -526,12 +543,15 @@ Parameters :
     native_context_t *ucontext : context structure given to signal handler
     int code : signal received
 
-    (no return value)
+Return :
+    TRUE if the registered hardware exception handler handled the exception, in
+    which case ucontext has been updated and the signal handler should return
+    to resume execution. FALSE otherwise.
 Note:
     the "pointers" parameter should contain a valid exception record pointer,
     but the contextrecord pointer will be overwritten.
 --*/
-static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
+static BOOL common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
                                   native_context_t *ucontext)
 {
     sigset_t signal_set;
@@ -544,10 +564,17 @@ static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
     // Fill context record with required information. from pal.h :
     // On non-Win32 platforms, the CONTEXT pointer in the
     // PEXCEPTION_POINTERS will contain at least the CONTEXT_CONTROL registers.
-    CONTEXTFromNativeContext(ucontext, &context, CONTEXT_CONTROL | CONTEXT_INTEGER);
+    CONTEXTFromNativeContext(ucontext, &context, CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_FLOATING_POINT);
 
     pointers->ContextRecord = &context;
 
+    if (g_hardwareExceptionHandler != NULL && g_hardwareExceptionHandler(pointers))
+    {
+        // The handler may have redirected execution or updated registers
+        CONTEXTToNativeContext(&context, ucontext);
+        return TRUE;
+    }
+
     /* Unmask signal so we can receive it again */
     sigemptyset(&signal_set);
     sigaddset(&signal_set, code);
@@ -559,6 +586,7 @@ static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
     // We do nothing further
     // xplat-todo : investigate further cleanup
     // SEHProcessException(pointers);
+    return FALSE;
 }
 
 /*++
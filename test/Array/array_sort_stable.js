@@ -0,0 +1,202 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Array.prototype.sort is a stable merge sort, with native paths for int and float arrays and for comparers of the
+// form (a, b) => a - b. Compare against a straightforward stable sort written in script.
+function referenceSort(array, compare) {
+    return array.map((value, index) => ({ value, index })).sort(function (x, y) {
+        var result = compare(x.value, y.value);
+        return result < 0 || result > 0 ? result : x.index - y.index;
+    }).map(entry => entry.value);
+}
+
+function numeric(a, b) {
+    var difference = a - b;
+    return difference;
+}
+
+function makeArray(length, pattern, seed) {
+    var array = [];
+    for (var i = 0; i < length; i++) {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+        switch (pattern) {
+            case 0: array.push(seed % 1000000); break;                       // random
+            case 1: array.push(seed % 7); break;                             // many equal keys
+            case 2: array.push(i); break;                                    // sorted
+            case 3: array.push(length - i); break;                           // reversed
+            case 4: array.push((i >> 6) % 2 ? i : length - i); break;        // alternating runs
+            default: array.push(seed % 23 == 0 ? seed % 1000 : i); break;    // nearly sorted
+        }
+    }
+    return array;
+}
+
+function assertSameValues(expected, actual, message) {
+    assert.areEqual(expected.length, actual.length, message + ": length");
+    for (var i = 0; i < expected.length; i++) {
+        if (!Object.is(expected[i], actual[i])) {
+            assert.fail(message + ": at index " + i + " expected " + expected[i] + " but found " + actual[i]);
+        }
+    }
+}
+
+var lengths = [0, 1, 2, 31, 32, 33, 100, 513, 2000, 10000];
+
+var tests = [
+    {
+        name: "Sort with a comparer is stable",
+        body: function () {
+            for (var pattern = 0; pattern < 6; pattern++) {
+                for (var length of lengths) {
+                    var array = makeArray(length, pattern, length + pattern).map((key, index) => ({ key: key % 50, index }));
+                    var byKey = (x, y) => x.key - y.key;
+                    var expected = referenceSort(array, byKey);
+                    array.sort((x, y) => x.key - y.key);
+                    assertSameValues(expected, array, "pattern " + pattern + ", length " + length);
+                }
+            }
+        }
+    },
+    {
+        name: "Sort without a comparer is stable",
+        body: function () {
+            var array = [];
+            for (var i = 0; i < 3000; i++) {
+                var value = (i * 7919) % 100;
+                array.push(i % 2 ? value : String(value));
+            }
+            var expected = referenceSort(array, (a, b) => String(a) < String(b) ? -1 : (String(a) > String(b) ? 1 : 0));
+            array.sort();
+            assertSameValues(expected, array, "mixed numbers and strings");
+        }
+    },
+    {
+        name: "Recognized numeric comparers on int, float and var arrays",
+        body: function () {
+            for (var pattern = 0; pattern < 6; pattern++) {
+                for (var length of lengths) {
+                    var ints = makeArray(length, pattern, 3 * length + pattern).map(value => value - 500000);
+                    var floats = ints.map(value => value / 4);
+                    var vars = ints.map((value, index) => index % 3 ? value : { valueOf() { return value; } });
+
+                    assertSameValues(referenceSort(ints, numeric), ints.slice().sort((a, b) => a - b), "ascending ints " + length);
+                    assertSameValues(referenceSort(ints, (a, b) => b - a), ints.slice().sort(function (x, y) { return y - x; }), "descending ints " + length);
+                    assertSameValues(referenceSort(floats, numeric), floats.slice().sort(function (a, b) { return a - b }), "ascending floats " + length);
+                    assertSameValues(referenceSort(floats, (a, b) => b - a), floats.slice().sort((a, b) => { return b - a; }), "descending floats " + length);
+                    assertSameValues(referenceSort(vars, numeric), vars.slice().sort((a, b) => a - b), "ascending vars " + length);
+                }
+            }
+        }
+    },
+    {
+        name: "Recognized comparers keep equal numbers in order",
+        body: function () {
+            var array = [0, -0, 1.5, 0, -0, -1.5, -0];
+            array.sort((a, b) => a - b);
+            assertSameValues([-1.5, 0, -0, 0, -0, -0, 1.5], array, "signed zeros");
+        }
+    },
+    {
+        name: "Recognized comparers still call valueOf on objects",
+        body: function () {
+            var calls = 0;
+            var array = [3, { valueOf() { calls++; return 2; } }, 1, "0"];
+            array.sort((a, b) => a - b);
+            assert.areEqual("0", array[0], "string element");
+            assert.areEqual(1, array[1], "number element");
+            assert.areEqual(2, +array[2], "object element");
+            assert.areEqual(3, array[3], "number element");
+            assert.isTrue(calls > 0, "valueOf was called");
+        }
+    },
+    {
+        name: "Lookalike comparers are called",
+        body: function () {
+            var calls = 0;
+            var a = 0;
+            function notDifference(x, y) { calls++; return x - y; }
+            [3, 1, 2].sort(notDifference);
+            assert.isTrue(calls > 0, "comparer with a side effect");
+
+            assertSameValues([3, 2, 1], [1, 3, 2].sort((x, y) => x - y - (x - y) * 2), "other arithmetic");
+            assertSameValues([1, 2, 3], [3, 1, 2].sort((x, y) => a - y + x), "free variable");
+        }
+    },
+    {
+        name: "Int arrays without a comparer sort in string order",
+        body: function () {
+            var array = [10, 9, 1, -1, -10, 100, 2147483647, -2147483648, 0, -9, 19, 2, 1000000000];
+            var expected = array.map(String).sort().map(Number);
+            assertSameValues(expected, array.sort(), "string order");
+
+            for (var length of lengths) {
+                var ints = makeArray(length, 0, length).map(value => value - 500000);
+                assertSameValues(referenceSort(ints, (a, b) => String(a) < String(b) ? -1 : (String(a) > String(b) ? 1 : 0)), ints.slice().sort(), "length " + length);
+            }
+        }
+    },
+    {
+        name: "Holes and undefined go to the end",
+        body: function () {
+            var ints = [3, , 1, , 2];
+            ints.sort();
+            assertSameValues([1, 2, 3], ints.slice(0, 3), "int array values");
+            assert.areEqual(5, ints.length, "int array length");
+            assert.isTrue(!(3 in ints) && !(4 in ints), "int array holes");
+
+            var floats = [3.5, , 1.5, 2.5, , ];
+            floats.sort((a, b) => b - a);
+            assertSameValues([3.5, 2.5, 1.5], floats.slice(0, 3), "float array values");
+            assert.areEqual(5, floats.length, "float array length");
+            assert.isTrue(!(3 in floats) && !(4 in floats), "float array holes");
+
+            var vars = [3, undefined, , 1, undefined, 2];
+            vars.sort((a, b) => a - b);
+            assertSameValues([1, 2, 3, undefined, undefined], vars.slice(0, 5), "var array values");
+            assert.areEqual(6, vars.length, "var array length");
+            assert.isTrue(!(5 in vars), "var array hole");
+        }
+    },
+    {
+        name: "An exception in the comparer leaves every element in the array",
+        body: function () {
+            for (var length of lengths) {
+                for (var limit = 1; limit < length * 4; limit = limit * 3 + 1) {
+                    var array = makeArray(length, 4, length).map((value, index) => value * 100000 + index);
+                    var calls = 0;
+                    try {
+                        array.sort(function (a, b) {
+                            if (++calls == limit) {
+                                throw new Error("stop");
+                            }
+                            return a - b + 0;
+                        });
+                    } catch (e) {
+                        assert.areEqual("stop", e.message, "comparer exception");
+                    }
+                    assertSameValues(makeArray(length, 4, length).map((value, index) => value * 100000 + index).sort(numeric), array.sort(numeric), "length " + length + ", limit " + limit);
+                }
+            }
+        }
+    },
+    {
+        name: "Inconsistent comparers leave every element in the array",
+        body: function () {
+            var seed = 1;
+            for (var length of lengths) {
+                var array = makeArray(length, 0, length).map((value, index) => index);
+                array.sort(function () {
+                    seed = (seed * 1103515245 + 12345) % 2147483648;
+                    return (seed >> 8) % 3 - 1;
+                });
+                assertSameValues(makeArray(length, 0, length).map((value, index) => index), array.sort(numeric), "length " + length);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
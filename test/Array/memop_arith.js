@@ -0,0 +1,205 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Element-wise loops over typed arrays are turned into a single helper call (Memadd, Memsub, Memmul).
+// Compares the values computed by the interpreter with the jitted code
+// need to run with -mic:1 -off:simplejit -off:jitloopbody
+// Run locally with -trace:memarith -trace:bailout to help find bugs
+
+let size = 200;
+
+function addScalar(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] + 3;
+  }
+}
+
+function subScalar(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] - 7;
+  }
+}
+
+function mulScalar(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] * 3;
+  }
+}
+
+function mulFloatScalar(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] * 0.5;
+  }
+}
+
+function scalarFirst(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = 5 + b[i];
+  }
+}
+
+function reversedSub(a, b, c, n) {
+  // Not commutative, must not be turned into a[i] = b[i] - 5
+  for(let i = 0; i < n; ++i) {
+    a[i] = 5 - b[i];
+  }
+}
+
+function invariantScalar(a, b, c, n) {
+  let k = n - 19;
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] + k;
+  }
+}
+
+function addArrays(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] + c[i];
+  }
+}
+
+function subArrays(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] - c[i];
+  }
+}
+
+function mulArrays(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    a[i] = b[i] * c[i];
+  }
+}
+
+function inPlace(a, b, c, n) {
+  for(let i = 0; i < n; ++i) {
+    b[i] = b[i] + c[i];
+  }
+}
+
+function decrementing(a, b, c, n) {
+  for(let i = n - 1; i >= 0; --i) {
+    a[i] = b[i] * c[i];
+  }
+}
+
+function tooLong(a, b, c, n) {
+  // Out of bounds accesses must behave as in the interpreter
+  for(let i = 0; i < n + 10; ++i) {
+    a[i] = b[i] + 1;
+  }
+}
+
+function valueUsedTwice(a, b, c, n) {
+  let sum = 0;
+  for(let i = 0; i < n; ++i) {
+    let v = b[i] + 1;
+    a[i] = v;
+    sum += v;
+  }
+  return sum;
+}
+
+let fns = [
+  addScalar,
+  subScalar,
+  mulScalar,
+  mulFloatScalar,
+  scalarFirst,
+  reversedSub,
+  invariantScalar,
+  addArrays,
+  subArrays,
+  mulArrays,
+  inPlace,
+  decrementing,
+  tooLong,
+  valueUsedTwice
+];
+
+let types = [
+  Float64Array,
+  Float32Array,
+  Int32Array,
+  Uint32Array,
+  Int16Array,
+  Uint16Array,
+  Int8Array,
+  Uint8Array,
+  Uint8ClampedArray
+];
+
+function fillValue(i, seed) {
+  // Mix of large, negative and fractional values to exercise wrapping, clamping and rounding
+  switch(i % 5) {
+    case 0: return i * seed;
+    case 1: return -i * seed;
+    case 2: return (i + 0.25) * seed / 3;
+    case 3: return 0x7fffff00 + i * seed;
+    default: return 200 + i;
+  }
+}
+
+function createArrays(type, layout) {
+  let buffer = new ArrayBuffer(size * 3 * type.BYTES_PER_ELEMENT);
+  let a, b, c;
+  if(layout === "aliased") {
+    // Destination overlaps the sources with an offset
+    a = new type(buffer, 0, size);
+    b = new type(buffer, type.BYTES_PER_ELEMENT, size);
+    c = new type(buffer, 2 * type.BYTES_PER_ELEMENT, size);
+  } else if(layout === "same") {
+    a = b = c = new type(buffer, 0, size);
+  } else {
+    a = new type(buffer, 0, size);
+    b = new type(buffer, size * type.BYTES_PER_ELEMENT, size);
+    c = new type(buffer, 2 * size * type.BYTES_PER_ELEMENT, size);
+  }
+  let all = new type(buffer);
+  for(let i = 0; i < all.length; ++i) {
+    all[i] = fillValue(i, 7);
+  }
+  return {a, b, c, all};
+}
+
+function test(fn, type, layout) {
+  let name = `${fn.name}(${type.name}, ${layout})`;
+  let results = [];
+  // First call is interpreted, the following ones are jitted
+  for(let run = 0; run < 3; ++run) {
+    let {a, b, c, all} = createArrays(type, layout);
+    let r = fn(a, b, c, size);
+    results.push({r, all});
+  }
+  return compare(results[0], results[1], name) && compare(results[0], results[2], name);
+}
+
+function compare(expected, actual, name) {
+  if(!Object.is(expected.r, actual.r)) {
+    print(`Error: ${name} interpret returned ${expected.r}, jit returned ${actual.r}`);
+    return false;
+  }
+  for(let i = 0; i < expected.all.length; ++i) {
+    if(!Object.is(expected.all[i], actual.all[i])) {
+      print(`Error: ${name} interpret[${i}] (${expected.all[i]}) !== jit[${i}] (${actual.all[i]})`);
+      return false;
+    }
+  }
+  return true;
+}
+
+let passed = true;
+for(let fn of fns) {
+  for(let type of types) {
+    for(let layout of ["distinct", "same", "aliased"]) {
+      passed &= test(fn, type, layout);
+    }
+  }
+}
+
+if(passed) {
+  print("PASSED");
+} else {
+  print("FAILED");
+}
@@ -0,0 +1,47 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse skips plain string contents and whitespace in blocks. Place the character that ends a run at every offset
+// within and across block boundaries.
+
+var TEST = function(a, b, message) {
+  if (a !== b) {
+    throw new Error(message + ": " + JSON.stringify(a) + " !== " + JSON.stringify(b));
+  }
+}
+
+var TEST_THROWS = function(f, message) {
+  try {
+    f();
+  } catch (e) {
+    if (e instanceof SyntaxError) {
+      return;
+    }
+    throw e;
+  }
+  throw new Error(message + ": expected SyntaxError");
+}
+
+var padding = "abcdefghijklmnopqrstuvwxyz\u00e9\u4e2d ".repeat(2);
+
+for (var i = 0; i < 40; i++) {
+  var text = padding.substr(0, i);
+
+  TEST(text, JSON.parse('"' + text + '"'), "plain string of length " + i);
+  TEST(text + '"' + text, JSON.parse('"' + text + '\\"' + text + '"'), "escaped quote after " + i + " characters");
+  TEST(text + '\\' + text, JSON.parse('"' + text + '\\\\' + text + '"'), "escaped backslash after " + i + " characters");
+  TEST(text + 'A' + text, JSON.parse('"' + text + '\\u0041' + text + '"'), "unicode escape after " + i + " characters");
+  TEST(text + '\n', JSON.parse('"' + text + '\\n"'), "trailing escape after " + i + " characters");
+  TEST_THROWS(function () { JSON.parse('"' + text + '\n' + text + '"'); }, "control character after " + i + " characters");
+  TEST_THROWS(function () { JSON.parse('"' + text + '\0' + text + '"'); }, "NUL after " + i + " characters");
+  TEST_THROWS(function () { JSON.parse('"' + text); }, "unterminated string of length " + i);
+
+  var spaces = " \t\r\n".repeat(i);
+  TEST(i, JSON.parse(spaces + i + spaces), (i * 4) + " whitespace characters");
+  TEST(i, JSON.parse('{' + spaces + '"' + text + '"' + spaces + ':' + spaces + i + spaces + '}')[text], "object with " + (i * 4) + " whitespace characters");
+  TEST_THROWS(function () { JSON.parse(spaces + 'x' + spaces); }, "illegal character after " + (i * 4) + " whitespace characters");
+}
+
+console.log("PASS");
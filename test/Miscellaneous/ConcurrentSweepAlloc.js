@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Allocates enough small objects of a handful of size classes to cross the heap bucket threshold for
+// allocating during concurrent sweep, while keeping a fraction of them alive and verifying that none of
+// the survivors get swept out from under us or handed out again by the allocator.
+
+// -RecyclerConcurrentStress starts a concurrent collection on allocation, so run only a couple of
+// iterations under it. That is still enough objects per size class to cross the debug build's heap
+// block threshold for allocating during concurrent sweep.
+var stress = WScript.Arguments[0] === "stress";
+var iterations = stress ? 2 : 20;
+var objectsPerIteration = stress ? 12000 : 40000;
+var survivors = [];
+
+function makeObject(i, j) {
+    switch (j % 3) {
+        case 0: return { a: i, b: j };
+        case 1: return { a: i, b: j, c: i + j, d: "" + j };
+        default: return [i, j, i ^ j];
+    }
+}
+
+function checkObject(o) {
+    var i, j;
+    if (Array.isArray(o)) {
+        i = o[0];
+        j = o[1];
+        return o.length === 3 && o[2] === (i ^ j) && j % 3 === 2;
+    }
+    i = o.a;
+    j = o.b;
+    if (j % 3 === 0) {
+        return o.c === undefined;
+    }
+    return o.c === i + j && o.d === "" + j;
+}
+
+for (var i = 0; i < iterations; i++) {
+    var garbage = [];
+    for (var j = 0; j < objectsPerIteration; j++) {
+        var o = makeObject(i, j);
+        if (j % 16 === 0) {
+            survivors.push(o);
+        } else {
+            garbage.push(o);
+        }
+    }
+    garbage = null;
+
+    if (i % 4 === 0) {
+        CollectGarbage();
+    }
+
+    // Drop the oldest survivors so that sweep has partially free blocks to hand back to the allocator.
+    if (survivors.length > objectsPerIteration) {
+        survivors.splice(0, objectsPerIteration / 4);
+    }
+}
+
+var ok = true;
+for (var k = 0; k < survivors.length; k++) {
+    if (!checkObject(survivors[k])) {
+        WScript.Echo("FAILED: survivor " + k + " is corrupt");
+        ok = false;
+        break;
+    }
+}
+
+if (ok) {
+    WScript.Echo("pass");
+}
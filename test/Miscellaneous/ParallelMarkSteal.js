@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Builds a heap where almost all of the reachable objects hang off a single deep chain next to a few
+// shallow, wide trees, so that a static split of the mark stack leaves most parallel markers idle.
+// Marking has to steal work from the context that got the chain, and nothing reachable may be lost.
+
+var chainLength = 200000;
+var treeCount = 8;
+var treeWidth = 2000;
+
+function Node(value, next) {
+    this.value = value;
+    this.next = next;
+    this.payload = [value, value * 2];
+}
+
+var chain = null;
+for (var i = 0; i < chainLength; i++) {
+    chain = new Node(i, chain);
+}
+
+var trees = [];
+for (var t = 0; t < treeCount; t++) {
+    var tree = [];
+    for (var w = 0; w < treeWidth; w++) {
+        tree.push({ t: t, w: w });
+    }
+    trees.push(tree);
+}
+
+function allocateGarbage() {
+    var garbage = [];
+    for (var k = 0; k < 50000; k++) {
+        garbage.push({ k: k });
+    }
+    return garbage.length;
+}
+
+for (var round = 0; round < 5; round++) {
+    allocateGarbage();
+    CollectGarbage();
+}
+
+var ok = true;
+var expected = chainLength - 1;
+for (var node = chain; node !== null; node = node.next) {
+    if (node.value !== expected || node.payload[1] !== expected * 2) {
+        WScript.Echo("FAILED: chain node " + expected + " is corrupt");
+        ok = false;
+        break;
+    }
+    expected--;
+}
+if (ok && expected !== -1) {
+    WScript.Echo("FAILED: chain is " + (chainLength - 1 - expected) + " nodes long");
+    ok = false;
+}
+
+for (var t = 0; ok && t < treeCount; t++) {
+    for (var w = 0; w < treeWidth; w++) {
+        if (trees[t][w].t !== t || trees[t][w].w !== w) {
+            WScript.Echo("FAILED: tree " + t + " is corrupt");
+            ok = false;
+            break;
+        }
+    }
+}
+
+if (ok) {
+    WScript.Echo("pass");
+}
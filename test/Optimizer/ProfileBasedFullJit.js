@@ -0,0 +1,27 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The first run of this test saves a dynamic profile in which hot() was full JIT'ed and cold() was not. The second run
+// loads it with -trace:ProfileBasedFullJit and should send only hot() straight to full JIT.
+
+function hot(a, b) {
+    return a + b;
+}
+
+function cold(a) {
+    return a * 2;
+}
+
+var sum = 0;
+for (var i = 0; i < 100; i++) {
+    sum = hot(sum, i);
+}
+sum = cold(sum);
+
+if (sum === 9900) {
+    WScript.Echo("pass");
+} else {
+    WScript.Echo("FAILED: " + sum);
+}
@@ -0,0 +1,86 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Regexes that never backtrack are switched to a linear program once they have been matched often enough. Run each
+// match past that point and make sure the result never changes.
+var iterations = 50;
+
+function execRepeatedly(re, input, expected, message) {
+    for (var i = 0; i < iterations; i++) {
+        re.lastIndex = 0;
+        var result = re.exec(input);
+        assert.areEqual(expected, result === null ? null : Array.prototype.slice.call(result), message + " (iteration " + i + ")");
+    }
+}
+
+var tests = [
+    {
+        name: "Characters, sets and literals",
+        body: function () {
+            execRepeatedly(/abc/, "xxabcx", ["abc"], "literal");
+            execRepeatedly(/abc/, "xxabx", null, "literal cut short by end of input");
+            execRepeatedly(/a[bc]d/, "abd acd", ["abd"], "two character set");
+            execRepeatedly(/[^a-z]x/, "axbx1x", ["1x"], "negated set");
+            execRepeatedly(/HELLO world/i, "say hello WORLD", ["hello WORLD"], "ignore case");
+            execRepeatedly(/a.c/, "a\nc abc", ["abc"], "dot");
+        }
+    },
+    {
+        name: "Chomps",
+        body: function () {
+            execRepeatedly(/\d+-\d+/, "tel 123-4567 ok", ["123-4567"], "set plus");
+            execRepeatedly(/x*y/, "aaxxy", ["xxy"], "char star");
+            execRepeatedly(/x+y/, "ay xy", ["xy"], "char plus");
+            execRepeatedly(/\d+-\d+/, "123-", null, "set plus without a following match");
+        }
+    },
+    {
+        name: "Anchors and word boundaries",
+        body: function () {
+            execRepeatedly(/^foo/, "foo bar", ["foo"], "beginning of input");
+            execRepeatedly(/^foo/, "a foo", null, "beginning of input later in the string");
+            execRepeatedly(/bar$/, "bar bar", ["bar"], "end of input");
+            execRepeatedly(/\bcat\b/, "concat cat", ["cat"], "word boundary");
+            execRepeatedly(/\Bcat/, "cat concat", ["cat"], "negated word boundary");
+            execRepeatedly(/^a$/m, "b\na\nc", ["a"], "multiline");
+        }
+    },
+    {
+        name: "Groups",
+        body: function () {
+            execRepeatedly(/(\w+)@(\w+)\.com/, "mail bob@example.com now", ["bob@example.com", "bob", "example"], "variable length groups");
+            execRepeatedly(/(ab)(c)d/, "xabcd", ["abcd", "ab", "c"], "fixed length groups");
+            execRepeatedly(/ERROR: (\w+)/, "INFO: ok\nERROR: disk\n", ["ERROR: disk", "disk"], "group after a literal");
+            execRepeatedly(/(\w+)@(\w+)\.com/, "bob@example.org", null, "groups when the match fails");
+        }
+    },
+    {
+        name: "Global and sticky matching",
+        body: function () {
+            for (var i = 0; i < iterations; i++) {
+                assert.areEqual(["1", "22", "333"], "a1b22c333".match(/\d+/g), "global match");
+                assert.areEqual("a#b#c#", "a1b22c333".replace(/\d+/g, "#"), "global replace");
+
+                var re = /foo/y;
+                re.lastIndex = 3;
+                assert.areEqual(["foo"], Array.prototype.slice.call(re.exec("barfoo")), "sticky match at lastIndex");
+                re.lastIndex = 2;
+                assert.areEqual(null, re.exec("barfoo"), "sticky match before lastIndex");
+            }
+        }
+    },
+    {
+        name: "Regexes that can backtrack keep being interpreted",
+        body: function () {
+            execRepeatedly(/abc|abd/, "xabd", ["abd"], "alternation");
+            execRepeatedly(/(a+)+b/, "aaab", ["aaab", "aaa"], "nested loop");
+            execRepeatedly(/(?=a)ab/, "bab", ["ab"], "assertion");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
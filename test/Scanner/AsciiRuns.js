@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// The scanner skips runs of plain ASCII characters in blocks. Place the character that ends a run at every offset
+// within and across block boundaries.
+function padding(n) {
+    return "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_$".repeat(2).substr(0, n);
+}
+
+var tests = [
+    {
+        name: "Identifiers of varying length",
+        body: function () {
+            for (let i = 1; i < 70; i++) {
+                let name = "x" + padding(i);
+                assert.areEqual(i, eval(`var ${name} = ${i}; ${name}`), `identifier of length ${name.length}`);
+                assert.areEqual(i, eval(`var ${name}\u00e9 = ${i}; ${name}\u00e9`), `identifier ending in a multi-unit character after ${name.length} characters`);
+                assert.areEqual(i, eval(`var ${name}\\u0041 = ${i}; ${name}A`), `identifier ending in an escape after ${name.length} characters`);
+                assert.areEqual(i, eval(`var ${name}=${i};${name}`), `identifier ending in a punctuator after ${name.length} characters`);
+            }
+        }
+    },
+    {
+        name: "String literals with special characters at varying offsets",
+        body: function () {
+            for (let i = 0; i < 70; i++) {
+                let text = padding(i);
+                assert.areEqual(text, eval(`"${text}"`), `plain double quoted string of length ${i}`);
+                assert.areEqual(text, eval(`'${text}'`), `plain single quoted string of length ${i}`);
+                assert.areEqual(text + "'" + text, eval(`"${text}'${text}"`), `other quote after ${i} characters`);
+                assert.areEqual(text + "\n" + text, eval(`"${text}\\n${text}"`), `escape after ${i} characters`);
+                assert.areEqual(text + "\u00e9" + text, eval(`"${text}\u00e9${text}"`), `multi-unit character after ${i} characters`);
+                assert.areEqual(text + "`$" + text, eval(`"${text}\`$${text}"`), `template characters after ${i} characters`);
+                assert.throws(() => eval(`"${text}\n"`), SyntaxError, `line break after ${i} characters`, "Unterminated string constant");
+            }
+        }
+    },
+    {
+        name: "Template literals with substitutions at varying offsets",
+        body: function () {
+            for (let i = 0; i < 70; i++) {
+                let text = padding(i);
+                assert.areEqual(text + "1" + text, eval("`" + text + "${1}" + text + "`"), `substitution after ${i} characters`);
+                assert.areEqual(text + "$" + text, eval("`" + text + "$" + text + "`"), `lone dollar after ${i} characters`);
+                assert.areEqual(text + "\n" + text, eval("`" + text + "\r\n" + text + "`"), `normalized line break after ${i} characters`);
+                assert.areEqual(text + "\\n", eval("String.raw`" + text + "\\n`"), `raw escape after ${i} characters`);
+            }
+        }
+    },
+    {
+        name: "Comments and whitespace of varying length",
+        body: function () {
+            for (let i = 0; i < 70; i++) {
+                let text = padding(i);
+                let spaces = " \t".repeat(i);
+                assert.areEqual(i, eval(`${spaces}${i}${spaces}`), `${i * 2} whitespace characters`);
+                assert.areEqual(i, eval(`// ${text}\n${i}`), `line comment of length ${i}`);
+                assert.areEqual(i, eval(`// ${text}\u2028${i}`), `line comment ending in a multi-unit line terminator after ${i} characters`);
+                assert.areEqual(i, eval(`// ${text}\u00e9${text}\r${i}`), `line comment with a multi-unit character after ${i} characters`);
+                assert.areEqual(i, eval(`/* ${text}*${text} */${i}`), `block comment with a star after ${i} characters`);
+                assert.areEqual(i, eval(`/* ${text}\n${text}\u00e9 */${i}`), `multi-line block comment with ${i} characters per line`);
+                assert.throws(() => eval(`/* ${text}`), SyntaxError, `unterminated block comment of length ${i}`, "Unterminated comment");
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
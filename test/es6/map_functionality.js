@@ -819,6 +819,70 @@ var tests = [
             assert.areEqual("test", map.get(key), "1.0 should be equal to the key 1 and map to 'test'");
         }
     },
+    {
+        name: "Iterators stay valid while deletions and insertions cause the entries to be compacted",
+        body: function() {
+            var map = new Map();
+            for (var i = 0; i < 100; i++) {
+                map.set(i, i * 2);
+            }
+
+            var seen = [];
+            var next = 100;
+            for (var [key, value] of map) {
+                assert.areEqual(key * 2, value, "value matches key " + key);
+                seen.push(key);
+                // Delete the entry just visited and add a new one, so that the table repeatedly fills up with holes
+                map.delete(key);
+                if (next < 300) {
+                    map.set(next, next * 2);
+                    next++;
+                }
+            }
+
+            assert.areEqual(300, seen.length, "every entry, including those added during iteration, is visited once");
+            for (var i = 0; i < seen.length; i++) {
+                assert.areEqual(i, seen[i], "entries are visited in insertion order");
+            }
+            assert.areEqual(0, map.size, "all entries were deleted");
+        }
+    },
+
+    {
+        name: "Updating the value of a key keeps its position, including across compaction",
+        body: function() {
+            var map = new Map();
+            var keys = ["a", {}, 1.5, "b", Symbol(), 2];
+            keys.forEach(function (k, i) { map.set(k, i); });
+            for (var i = 0; i < 50; i++) {
+                map.set("temp" + i, i);
+                map.delete("temp" + i);
+            }
+            map.set(keys[0], "first");
+
+            assert.areEqual(keys.length, map.size, "only the original keys remain");
+            assert.areEqual(keys, Array.from(map.keys()), "keys keep their insertion order");
+            assert.areEqual("first", map.get(keys[0]), "updated value is found");
+            assert.areEqual(5, map.get(keys[5]), "other values are unchanged");
+        }
+    },
+
+    {
+        name: "Iterators created before a clear continue with entries added after it",
+        body: function() {
+            var map = getNewMapWith12345();
+            var iter = map.keys();
+            assert.areEqual(1, iter.next().value, "first key before clear");
+
+            map.clear();
+            map.set(10, 0);
+            map.set(11, 0);
+
+            assert.areEqual(10, iter.next().value, "iteration resumes at the first key added after clear");
+            assert.areEqual(11, iter.next().value, "followed by the next one");
+            assert.isTrue(iter.next().done, "and then completes");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
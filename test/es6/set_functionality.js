@@ -742,6 +742,54 @@ var tests = [
             assert.isTrue(set.has(value), "1.0 should be equal to the value 1 and set has it");
         }
     },
+    {
+        name: "Iterators stay valid while deletions and insertions cause the entries to be compacted",
+        body: function() {
+            var set = new Set();
+            for (var i = 0; i < 100; i++) {
+                set.add("v" + i);
+            }
+
+            var seen = [];
+            var next = 100;
+            for (var value of set) {
+                seen.push(value);
+                set.delete(value);
+                if (next < 300) {
+                    set.add("v" + next);
+                    next++;
+                }
+            }
+
+            assert.areEqual(300, seen.length, "every value, including those added during iteration, is visited once");
+            for (var i = 0; i < seen.length; i++) {
+                assert.areEqual("v" + i, seen[i], "values are visited in insertion order");
+            }
+            assert.areEqual(0, set.size, "all values were deleted");
+        }
+    },
+
+    {
+        name: "Int sets keep insertion order when they grow past their initial capacity",
+        body: function() {
+            var set = new Set();
+            var expected = [];
+            for (var i = 0; i < 100; i++) {
+                var v = (i * 37) % 101;
+                set.add(v);
+                expected.push(v);
+            }
+            var iter = set.values();
+            assert.areEqual(expected[0], iter.next().value, "first value");
+
+            set.delete(expected[1]);
+            set.add("not an int");
+            expected.splice(1, 1);
+            expected.push("not an int");
+
+            assert.areEqual(expected.slice(1), Array.from(iter), "iterator continues in order after promotion");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,171 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Verifies %TypedArray%.prototype.sort without a comparator, which sorts by value
+
+if (this.WScript && this.WScript.LoadScriptFile) { // Check for running in ch
+    this.WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+}
+
+var TypedArrayCtors = [
+    Int8Array,
+    Uint8Array,
+    Uint8ClampedArray,
+    Int16Array,
+    Uint16Array,
+    Int32Array,
+    Uint32Array,
+    Float32Array,
+    Float64Array
+];
+
+// Orders like the spec'd default comparison: NaN last, -0 before +0
+function compareNumbers(x, y) {
+    if (x !== x) {
+        return y !== y ? 0 : 1;
+    }
+    if (y !== y) {
+        return -1;
+    }
+    if (x === 0 && y === 0) {
+        return Object.is(x, -0) ? (Object.is(y, -0) ? 0 : -1) : (Object.is(y, -0) ? 1 : 0);
+    }
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+// Deterministic pseudo random values covering the whole range of every element type
+var seed = 1;
+function nextRandom() {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    return seed;
+}
+
+function fillRandom(ta, range) {
+    for (var i = 0; i < ta.length; i++) {
+        var value = nextRandom() % range - range / 2;
+        if (ta instanceof Float32Array || ta instanceof Float64Array) {
+            value = value / 7 * Math.pow(2, nextRandom() % 40 - 20);
+        } else if (range > 0x10000) {
+            value = value * 0x10001 + nextRandom();
+        }
+        ta[i] = value;
+    }
+    return ta;
+}
+
+function verifySorted(ta, description) {
+    var expected = Array.prototype.slice.call(ta).sort(compareNumbers);
+    ta.sort();
+    for (var i = 0; i < ta.length; i++) {
+        if (!Object.is(ta[i], expected[i])) {
+            assert.fail(description + ": element " + i + " is " + ta[i] + ", expected " + expected[i]);
+            return;
+        }
+    }
+}
+
+var tests = [
+    {
+        name: "Sorting random values of every length up to the radix sort threshold and beyond",
+        body: function () {
+            for (var ctor of TypedArrayCtors) {
+                for (var length = 0; length < 80; length++) {
+                    verifySorted(fillRandom(new ctor(length), 1 << 30), ctor.name + " of length " + length);
+                }
+            }
+        }
+    },
+    {
+        name: "Sorting large arrays with narrow and wide value ranges",
+        body: function () {
+            for (var ctor of TypedArrayCtors) {
+                verifySorted(fillRandom(new ctor(5000), 100), ctor.name + " with small values");
+                verifySorted(fillRandom(new ctor(5000), 1 << 30), ctor.name + " with large values");
+                verifySorted(fillRandom(new ctor(4999), 1 << 30), ctor.name + " with an odd length");
+            }
+        }
+    },
+    {
+        name: "Sorting already sorted, reversed and constant arrays",
+        body: function () {
+            for (var ctor of TypedArrayCtors) {
+                var ta = new ctor(1000);
+                for (var i = 0; i < ta.length; i++) {
+                    ta[i] = i;
+                }
+                verifySorted(ta, ctor.name + " sorted");
+                ta.reverse();
+                verifySorted(ta, ctor.name + " reversed");
+                ta.fill(42);
+                verifySorted(ta, ctor.name + " constant");
+            }
+        }
+    },
+    {
+        name: "Extreme values of integer arrays",
+        body: function () {
+            assert.areEqual([-128, -1, 0, 1, 127], Array.from(new Int8Array([127, 0, -128, 1, -1]).sort()));
+            assert.areEqual([0, 1, 128, 255], Array.from(new Uint8Array([255, 128, 0, 1]).sort()));
+            assert.areEqual([-32768, -1, 0, 32767], Array.from(new Int16Array([32767, -1, -32768, 0]).sort()));
+            assert.areEqual([0, 1, 0x8000, 0xffff], Array.from(new Uint16Array([0xffff, 0x8000, 1, 0]).sort()));
+            assert.areEqual([-0x80000000, -1, 0, 0x7fffffff], Array.from(new Int32Array([0x7fffffff, -1, -0x80000000, 0]).sort()));
+            assert.areEqual([0, 1, 0x80000000, 0xffffffff], Array.from(new Uint32Array([0xffffffff, 0x80000000, 1, 0]).sort()));
+        }
+    },
+    {
+        name: "NaN, infinities and signed zeros in float arrays",
+        body: function () {
+            for (var ctor of [Float32Array, Float64Array]) {
+                for (var length of [10, 100]) {
+                    var ta = new ctor(length);
+                    var specials = [NaN, -0, 0, Infinity, -Infinity, -NaN, 1.5, -1.5, Number.MIN_VALUE, -Number.MIN_VALUE];
+                    for (var i = 0; i < length; i++) {
+                        ta[i] = specials[(i * 7) % specials.length];
+                    }
+                    // Also include a NaN with the sign bit set
+                    new Uint8Array(ta.buffer)[ta.BYTES_PER_ELEMENT - 1] |= 0x80;
+                    new Uint8Array(ta.buffer)[ta.BYTES_PER_ELEMENT - 2] |= 0xf0;
+                    verifySorted(ta, ctor.name + " of length " + length);
+
+                    assert.isTrue(Object.is(ta[0], -Infinity), "-Infinity sorts first");
+                    var firstZero = Array.prototype.findIndex.call(ta, function (x) { return x === 0; });
+                    assert.isTrue(Object.is(ta[firstZero], -0), "-0 sorts before +0");
+                    assert.isTrue(isNaN(ta[length - 1]), "NaN sorts last");
+                }
+            }
+        }
+    },
+    {
+        name: "Sorting views into a larger buffer only sorts the view",
+        body: function () {
+            var buffer = new ArrayBuffer(4 * 200);
+            var whole = new Int32Array(buffer);
+            for (var i = 0; i < whole.length; i++) {
+                whole[i] = whole.length - i;
+            }
+            var view = new Int32Array(buffer, 4 * 50, 100);
+            view.sort();
+            for (var i = 0; i < 50; i++) {
+                assert.areEqual(whole.length - i, whole[i], "elements before the view are untouched");
+                assert.areEqual(50 - i, whole[150 + i], "elements after the view are untouched");
+            }
+            for (var i = 0; i < 100; i++) {
+                assert.areEqual(51 + i, view[i], "view is sorted");
+            }
+        }
+    },
+    {
+        name: "Sorting with a comparator still calls the comparator",
+        body: function () {
+            var calls = 0;
+            var ta = new Int32Array([3, 1, 2]);
+            ta.sort(function (x, y) { calls++; return y - x; });
+            assert.areEqual([3, 2, 1], Array.from(ta));
+            assert.isTrue(calls > 0, "comparator was called");
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
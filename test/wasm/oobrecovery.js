@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Out of bounds accesses to guarded (fast) array buffers from JIT'd code fault and are recovered from:
+// wasm traps with a RuntimeError, asm.js and plain JS accesses load 0/NaN/undefined and drop the store.
+// Each access is repeated so that the functions are JIT'd and the recovery runs many times.
+const iterations = 200;
+const outOfBoundsAddresses = [0x10000, 0x10004, 0x7FFFFFF8, 0xFFFFFFF8];
+
+function testWasm() {
+  const {exports: {load, loadf64, store, mem}} = new WebAssembly.Instance(new WebAssembly.Module(WebAssembly.wabt.convertWast2Wasm(`
+  (module
+    (memory (export "mem") 1)
+    (func (export "load") (param i32) (result i32) (i32.load (get_local 0)))
+    (func (export "loadf64") (param i32) (result f64) (f64.load (get_local 0)))
+    (func (export "store") (param i32) (i32.store (get_local 0) (i32.const 42)))
+  )`)));
+
+  function checkTrap(fn, address) {
+    try {
+      fn(address);
+      print(`FAILED: wasm ${fn.name}(${address}) should have trapped`);
+    } catch (e) {
+      if (!(e instanceof WebAssembly.RuntimeError)) {
+        print(`FAILED: wasm ${fn.name}(${address}) threw ${e}`);
+      }
+    }
+  }
+
+  for (let i = 0; i < iterations; i++) {
+    store(0x100);
+    for (const address of outOfBoundsAddresses) {
+      checkTrap(load, address);
+      checkTrap(loadf64, address);
+      checkTrap(store, address);
+    }
+    if (load(0x100) !== 42) {
+      print("FAILED: wasm in bounds load after a trap");
+    }
+  }
+
+  // Script accesses to the wasm memory aren't wasm traps
+  const view = new Int32Array(mem.buffer);
+  function readView(index) {
+    return view[index] | 0;
+  }
+  function writeView(index) {
+    view[index] = 1;
+  }
+  for (let i = 0; i < iterations; i++) {
+    try {
+      writeView(0x4000 + (i & 7));
+      if (readView(0x4000 + (i & 7)) !== 0) {
+        print("FAILED: out of bounds view load");
+      }
+    } catch (e) {
+      print(`FAILED: out of bounds view access threw ${e}`);
+    }
+  }
+  if (load(0x100) !== 42) {
+    print("FAILED: wasm memory changed by out of bounds view stores");
+  }
+}
+
+function AsmModule(stdlib, foreign, heap) {
+  "use asm";
+  var HEAP32 = new stdlib.Int32Array(heap);
+  var HEAPF64 = new stdlib.Float64Array(heap);
+  function load(i) {
+    i = i | 0;
+    return HEAP32[i >> 2] | 0;
+  }
+  function loadf64(i) {
+    i = i | 0;
+    return +HEAPF64[i >> 3];
+  }
+  function store(i) {
+    i = i | 0;
+    HEAP32[i >> 2] = 42;
+  }
+  return {load: load, loadf64: loadf64, store: store};
+}
+
+function testAsmJs() {
+  const {load, loadf64, store} = AsmModule(this, {}, new ArrayBuffer(0x10000));
+  for (let i = 0; i < iterations; i++) {
+    store(0x100);
+    for (const address of outOfBoundsAddresses.slice(0, 3)) {
+      try {
+        store(address);
+        if (load(address) !== 0) {
+          print(`FAILED: asm.js load(${address})`);
+        }
+        if (!isNaN(loadf64(address))) {
+          print(`FAILED: asm.js loadf64(${address})`);
+        }
+      } catch (e) {
+        print(`FAILED: asm.js access to ${address} threw ${e}`);
+      }
+    }
+    if (load(0x100) !== 42) {
+      print("FAILED: asm.js in bounds load after an out of bounds access");
+    }
+  }
+}
+
+testWasm();
+testAsmJs();
+print("PASSED");